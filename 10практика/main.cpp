@@ -5,90 +5,1517 @@
 #include <mutex>        // підключення бібліотеки для синхронізації потоків
 #include <iomanip>      // підключення бібліотеки для форматування виводу
 #include <locale>       // підключення бібліотеки для роботи з локалізацією
+#include <string>       // підключення бібліотеки для роботи з рядками
+#include <limits>       // підключення бібліотеки для граничних значень типів
+#include <chrono>       // підключення бібліотеки для вимірювання часу
+#include <algorithm>    // підключення бібліотеки алгоритмів (min, max)
+#include <cmath>        // підключення бібліотеки математичних функцій (frexp, ldexp, log10)
+#include <sstream>      // підключення бібліотеки для форматування у рядок
+#include <deque>        // підключення бібліотеки двосторонніх черг (деки задач пулу)
+#include <functional>   // підключення бібліотеки для std::function
+#include <future>       // підключення бібліотеки для future/packaged_task
+#include <condition_variable> // підключення бібліотеки умовних змінних
+#include <atomic>       // підключення бібліотеки атомарних змінних
+#include <memory>       // підключення бібліотеки розумних покажчиків
+#include <cstdint>      // підключення бібліотеки цілих типів фіксованого розміру
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAVE_SSE2 1     // SSE2 є на кожному x86-64 - векторні ядра редукції
+#include <emmintrin.h>  // підключення інтринсиків SSE2
+#endif
+#ifdef _WIN32
+#define NOMINMAX        // щоб windows.h не визначав макроси min/max
+#include <windows.h>    // підключення WinAPI для закріплення потоків за ядрами
+#else
+#include <unistd.h>     // підключення sysconf для визначення розмірів кешів
+#include <pthread.h>    // підключення pthread для закріплення потоків за ядрами
+#endif
 
 using namespace std;    // використання стандартного простору імен
 
+// ===================== Стійкі до похибок акумулятори =====================
+// Сума накопичується з компенсацією похибки округлення (алгоритм Ноймаєра),
+// а добуток зберігається як мантиса + двійковий порядок, тому не переповнюється
+// до inf і не зникає до 0 навіть на мільйонах множників.
+
+// Компенсована сума (Kahan-Neumaier)
+struct NeumaierSum {
+    double sum = 0.0;           // наближене значення суми
+    double compensation = 0.0;  // накопичена похибка округлення
+
+    // Додавання одного доданка. Похибку округлення дає 2Sum Кнута - та сама точна похибка,
+    // що й у Ноймаєра, але без порівняння модулів (і без розгалуження)
+    void add(double x) {
+        double t = sum + x;
+        double xPart = t - sum;     // частина x, що увійшла в t
+        compensation += (sum - (t - xPart)) + (x - xPart);
+        sum = t;
+    }
+
+    // Об'єднання з іншою частковою сумою
+    void merge(const NeumaierSum& other) {
+        add(other.sum);
+        compensation += other.compensation;
+    }
+
+    // Остаточне значення суми
+    double value() const {
+        return sum + compensation;
+    }
+};
+
+// Добуток у вигляді mantissa * 2^exponent
+struct ScaledProduct {
+    double mantissa = 1.0;      // мантиса (за модулем у межах [2^-500, 2^500] між множеннями)
+    long long exponent = 0;     // двійковий порядок
+
+    // Множення на одне число
+    void mul(double x) {
+        if (fabs(x) > 0x1p500 || (x != 0.0 && fabs(x) < 0x1p-500)) {
+            int e = 0;
+            x = frexp(x, &e);   // дуже великий або малий множник розкладаємо заздалегідь
+            exponent += e;
+        }
+        mantissa *= x;
+        // Нормалізація лише коли мантиса стала малою або великою - дешево і без переповнення
+        if (fabs(mantissa) < 0x1p-500 || fabs(mantissa) > 0x1p500) {
+            normalize();
+        }
+    }
+
+    // Приведення мантиси до проміжку [0.5, 1)
+    void normalize() {
+        if (mantissa == 0.0 || !isfinite(mantissa)) {
+            return;             // нуль, inf та NaN не нормалізуються
+        }
+        int e = 0;
+        mantissa = frexp(mantissa, &e);
+        exponent += e;
+    }
+
+    // Об'єднання з іншим частковим добутком
+    void merge(const ScaledProduct& other) {
+        mantissa *= other.mantissa;
+        exponent += other.exponent;
+        normalize();
+    }
+
+    // Значення у типі double (може бути 0 або inf, якщо виходить за межі типу)
+    double value() const {
+        if (exponent > numeric_limits<int>::max() || exponent < numeric_limits<int>::min()) {
+            return mantissa == 0.0 ? 0.0 : (exponent > 0 ? copysign(HUGE_VAL, mantissa) : copysign(0.0, mantissa));
+        }
+        return ldexp(mantissa, int(exponent));
+    }
+
+    // Десятковий запис: звичайний (2 знаки після коми) лише для |P| у [1e-2, 1e15], інакше
+    // m.mmmm e+-N - щоб не друкувати сотні цифр і не показувати малий добуток як 0.00.
+    // Порядок рахується з мантиси та двійкового порядку, тож не губиться і поза межами double
+    string toString() const {
+        double magnitude = fabs(value());
+        if (mantissa == 0.0 || !isfinite(mantissa) || (magnitude >= 1e-2 && magnitude <= 1e15)) {
+            ostringstream oss;
+            oss << fixed << setprecision(2) << value();
+            return oss.str();
+        }
+        // log10|P| = log10|m| + e * log10(2)
+        double log10p = log10(fabs(mantissa)) + double(exponent) * log10(2.0);
+        double power = floor(log10p);
+        double digits = pow(10.0, log10p - power);
+        if (digits >= 9.99995) {    // після округлення до 4 знаків вийшло б 10.0000
+            digits /= 10.0;
+            power += 1.0;
+        }
+        ostringstream oss;
+        oss << (mantissa < 0 ? "-" : "") << fixed << setprecision(4) << digits
+            << "e" << (power >= 0 ? "+" : "") << (long long)power;
+        return oss.str();
+    }
+};
+
 // Глобальні змінні для результатів
 double sum_result = 0.0;      // змінна для збереження суми чисел більших за 15
-double product_result = 1.0;  // змінна для збереження добутку чисел менших за 10
-mutex mtx;                    // м'ютекс для синхронізації виводу на консоль
-vector<double> arr(10);       // масив з 10 чисел типу double
+ScaledProduct product_result; // змінна для збереження добутку чисел менших за 10 (мантиса + порядок)
+// Алокатор, що не ініціалізує елементи при resize: сторінки пам'яті виділяються фізично
+// лише при першому записі (first touch) - тим потоком, який потім їх і читатиме
+template <typename T>
+struct DefaultInitAllocator : allocator<T> {
+    template <typename U>
+    struct rebind { using other = DefaultInitAllocator<U>; };
 
-// Функція для потоку T0 - знаходження суми чисел більших за 15
-void thread_T0() {
-    double local_sum = 0.0;   // локальна змінна для накопичення суми
-    
-    // Прохід по всіх елементах масиву
-    for (int i = 0; i < arr.size(); i++) {
-        if (arr[i] > 15.0) {  // перевірка умови: число більше за 15
-            local_sum += arr[i]; // додавання числа до суми
+    DefaultInitAllocator() = default;
+    template <typename U>
+    DefaultInitAllocator(const DefaultInitAllocator<U>&) noexcept {}
+
+    // Ініціалізація за замовчуванням замість обнулення
+    template <typename U>
+    void construct(U* p) noexcept(is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(p)) U;
+    }
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+using DoubleArray = vector<double, DefaultInitAllocator<double>>; // масив без початкового обнулення
+
+DoubleArray arr(10);          // масив чисел типу double (за замовчуванням 10)
+
+// ===================== Неблокуючий канал результатів та журналу =====================
+// Робочі потоки не друкують самі і не беруть м'ютекс: вони кладуть записи в обмежений
+// кільцевий буфер MPSC (багато виробників - один споживач) без блокувань, а окремий
+// потік-споживач форматує записи та виводить їх на консоль.
+
+// Кільцевий буфер MPSC без блокувань (кожна комірка має лічильник послідовності)
+template <typename T>
+class MpscRing {
+private:
+    struct Cell {
+        atomic<size_t> sequence;    // номер позиції, для якої комірка готова
+        T data;                     // дані запису
+    };
+
+    unique_ptr<Cell[]> cells;       // комірки буфера
+    size_t mask;                    // ємність - 1 (ємність - степінь двійки)
+    alignas(64) atomic<size_t> tail{0}; // наступна позиція для запису (спільна для виробників)
+    alignas(64) size_t head = 0;    // наступна позиція для читання (лише споживач)
+
+public:
+    // Створення буфера; ємність округлюється до степеня двійки
+    explicit MpscRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        cells.reset(new Cell[size]);
+        mask = size - 1;
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, memory_order_relaxed);
         }
     }
-    
-    sum_result = local_sum;   // збереження результату в глобальну змінну
-    
-    // Синхронізований вивід результату
-    lock_guard<mutex> lock(mtx); // блокування м'ютекса для безпечного виводу
-    cout << "Потік T0 : Сума чисел більших за 15 = " << fixed << setprecision(2) << sum_result << endl;
+
+    // Спроба додати запис (будь-який потік); false - буфер заповнений
+    bool tryPush(const T& value) {
+        size_t pos = tail.load(memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & mask];
+            size_t seq = cell.sequence.load(memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                // Комірка вільна - пробуємо зайняти позицію
+                if (tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    cell.data = value;
+                    cell.sequence.store(pos + 1, memory_order_release); // запис готовий для споживача
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;       // споживач ще не звільнив комірку - буфер заповнений
+            } else {
+                pos = tail.load(memory_order_relaxed); // іншій виробник нас випередив
+            }
+        }
+    }
+
+    // Спроба забрати запис (лише потік-споживач); false - буфер порожній
+    bool tryPop(T& value) {
+        Cell& cell = cells[head & mask];
+        if (cell.sequence.load(memory_order_acquire) != head + 1) {
+            return false;
+        }
+        value = move(cell.data);
+        cell.sequence.store(head + mask + 1, memory_order_release); // комірка вільна на наступному колі
+        head++;
+        return true;
+    }
+};
+
+// Вид запису в каналі
+enum class RecordKind { Log, Sum, Product, Value };
+
+// Запис каналу: лише POD-поля та рядкові літерали, щоб виробник не виділяв пам'ять
+struct Record {
+    RecordKind kind = RecordKind::Log;  // вид запису
+    const char* source = "";            // хто надіслав (потік/етап)
+    const char* text = "";              // повідомлення або назва результату
+    double value = 0.0;                 // числовий результат
+    int precision = 2;                  // кількість знаків після коми
+    ScaledProduct product;              // результат-добуток (для RecordKind::Product)
+};
+
+// Канал результатів: виробники публікують записи, потік-споживач виводить їх
+class ResultChannel {
+private:
+    MpscRing<Record> ring{1024};        // буфер записів
+    thread consumer;                    // потік-споживач
+    atomic<bool> running{false};        // прапорець роботи споживача
+    atomic<size_t> published{0};        // кількість опублікованих записів
+    atomic<size_t> processed{0};        // кількість виведених записів
+
+    // Форматування одного запису (виконується лише потоком-споживачем)
+    void handle(const Record& r) {
+        switch (r.kind) {
+            case RecordKind::Log:
+                cout << "[" << r.source << "] " << r.text << "\n";
+                break;
+            case RecordKind::Sum:
+                sum_result = r.value;   // глобальний результат пише лише споживач
+                cout << r.source << " : " << r.text << " = " << fixed << setprecision(r.precision) << r.value << "\n";
+                break;
+            case RecordKind::Product:
+                product_result = r.product;
+                cout << r.source << " : " << r.text << " = " << r.product.toString() << "\n";
+                break;
+            case RecordKind::Value:
+                cout << r.source << " : " << r.text << " = " << fixed << setprecision(r.precision) << r.value << "\n";
+                break;
+        }
+    }
+
+    // Головний цикл споживача: виводить записи пачками, поки канал не зупинено і не спорожнено
+    void consumeLoop() {
+        Record r;
+        while (true) {
+            bool any = false;
+            while (ring.tryPop(r)) {
+                handle(r);
+                processed++;
+                any = true;
+            }
+            if (any) {
+                cout.flush();           // один flush на пачку замість endl на кожен рядок
+            } else if (!running && processed == published) {
+                return;
+            } else {
+                this_thread::sleep_for(chrono::microseconds(50));
+            }
+        }
+    }
+
+public:
+    // Запуск потоку-споживача
+    void start() {
+        running = true;
+        consumer = thread(&ResultChannel::consumeLoop, this);
+    }
+
+    // Публікація запису; виробник ніколи не чекає на вивід - лише на вільну комірку буфера
+    void publish(const Record& r) {
+        published++;
+        while (!ring.tryPush(r)) {
+            this_thread::yield();
+        }
+    }
+
+    // Зупинка споживача після виводу всіх записів
+    void stop() {
+        if (consumer.joinable()) {
+            running = false;
+            consumer.join();
+        }
+    }
+
+    ~ResultChannel() {
+        stop();
+    }
+};
+
+ResultChannel channel;                  // канал результатів для всіх робочих потоків
+
+// Публікація рядка журналу від робочого потоку (текст - рядковий літерал, без виділення пам'яті)
+void publishLog(const char* source, const char* text) {
+    Record r;
+    r.kind = RecordKind::Log;
+    r.source = source;
+    r.text = text;
+    channel.publish(r);
 }
 
-// Функція для потоку T1 - знаходження добутку чисел менших за 10
-void thread_T1() {
-    double local_product = 1.0; // локальна змінна для накопичення добутку
-    bool found = false;         // прапорець для перевірки наявності чисел менших за 10
-    
-    // Прохід по всіх елементах масиву
-    for (int i = 0; i < arr.size(); i++) {
-        if (arr[i] < 10.0) {    // перевірка умови: число менше за 10
-            local_product *= arr[i]; // множення числа на добуток
-            found = true;       // встановлення прапорця
+// ===================== Топологія: кеші та закріплення потоків =====================
+
+// Розміри кешів процесора (у байтах)
+struct CacheInfo {
+    size_t l1 = 32 * 1024;          // кеш даних L1 на ядро
+    size_t l2 = 1024 * 1024;        // кеш L2 на ядро
+    size_t l3 = 8 * 1024 * 1024;    // спільний кеш L3
+
+    // Визначення розмірів кешів (якщо ОС не повідомляє - типові значення)
+    static CacheInfo detect() {
+        CacheInfo info;
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+        long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+        long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (l1 > 0) info.l1 = size_t(l1);
+        if (l2 > 0) info.l2 = size_t(l2);
+        if (l3 > 0) info.l3 = size_t(l3);
+#endif
+        return info;
+    }
+};
+
+// Розміри кешів визначаються один раз
+const CacheInfo& cacheInfo() {
+    static const CacheInfo info = CacheInfo::detect();
+    return info;
+}
+
+// Логічні ядра, на яких процесу дозволено працювати (маска спорідненості: taskset, cgroups)
+vector<unsigned> allowedCpus() {
+    vector<unsigned> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
         }
     }
+#elif defined(_WIN32)
+    DWORD_PTR processMask = 0, systemMask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+        for (unsigned cpu = 0; cpu < 8 * sizeof(DWORD_PTR); cpu++) {
+            if (processMask & (DWORD_PTR(1) << cpu)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty()) {                 // маску не отримано - усі ядра за hardware_concurrency
+        for (unsigned cpu = 0; cpu < max(1u, thread::hardware_concurrency()); cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+// Закріплення поточного потоку за index-м (за модулем) із дозволених процесу ядер
+bool pinCurrentThread(unsigned index) {
+    static const vector<unsigned> cpus = allowedCpus();
+    unsigned cpu = cpus[index % cpus.size()];
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#else
+    (void)cpu;
+    return false;                   // на інших системах потоки не закріплюються
+#endif
+}
+
+// ===================== Пул потоків з крадіжкою задач (work stealing) =====================
+// Потоки створюються один раз і живуть увесь час роботи програми. Кожен робочий потік
+// має власну деку задач: свої задачі бере з кінця (LIFO - дані ще в кеші), а коли
+// своя дека порожня - краде з початку чужих (FIFO - найбільші, найстаріші задачі).
+
+class ThreadPool {
+private:
+    // Дека задач одного робочого потоку
+    struct WorkQueue {
+        mutex m;                            // захист деки
+        deque<function<void()>> tasks;      // задачі потоку (можна красти)
+        deque<function<void()>> affine;     // задачі, прив'язані саме до цього потоку (не крадуться)
+        atomic<size_t> affinePending{0};    // кількість прив'язаних задач, що чекають
+    };
+
+    vector<unique_ptr<WorkQueue>> queues;   // дека для кожного робочого потоку
+    vector<thread> threads;                 // робочі потоки
+    atomic<size_t> pending{0};              // кількість задач, що чекають у деках
+    atomic<size_t> nextQueue{0};            // лічильник для розподілу зовнішніх задач по колу
+    atomic<bool> stopping{false};           // прапорець завершення роботи пулу
+    bool pinned = false;                    // чи запитано закріплення робочих потоків за ядрами
+    atomic<unsigned> pinAttempts{0};        // скільки потоків уже спробували закріпитись
+    atomic<unsigned> pinSuccesses{0};       // скільки потоків закріпились успішно
+    mutex sleepMutex;                       // м'ютекс для очікування нових задач
+    condition_variable wakeUp;              // сповіщення сплячих потоків
+
+    // Індекс поточного робочого потоку (-1 для потоків поза пулом)
+    static int& workerIndex() {
+        static thread_local int index = -1;
+        return index;
+    }
+
+    // Додавання задачі: з робочого потоку - у власну деку, ззовні - по колу
+    void push(function<void()> task) {
+        int self = workerIndex();
+        size_t target = self >= 0 ? size_t(self) : nextQueue++ % queues.size();
+        {
+            lock_guard<mutex> lock(queues[target]->m);
+            pending++;                      // до появи задачі в деці, щоб лічильник не став від'ємним
+            queues[target]->tasks.push_back(move(task));
+        }
+        lock_guard<mutex> lock(sleepMutex); // щоб сповіщення не загубилось між перевіркою та wait
+        wakeUp.notify_one();
+    }
+
+    // Додавання задачі, яку виконає лише робочий потік index
+    void pushAffine(size_t index, function<void()> task) {
+        {
+            lock_guard<mutex> lock(queues[index]->m);
+            queues[index]->affinePending++;
+            queues[index]->affine.push_back(move(task));
+        }
+        lock_guard<mutex> lock(sleepMutex);
+        wakeUp.notify_all();                // невідомо, котрий потік спить - будимо всіх
+    }
+
+    // Спроба взяти задачу: спочатку прив'язані та власні, потім крадіжка з чужих дек
+    bool tryTake(function<void()>& task) {
+        int self = workerIndex();
+        if (self >= 0) {
+            WorkQueue& own = *queues[self];
+            lock_guard<mutex> lock(own.m);
+            if (!own.affine.empty()) {
+                task = move(own.affine.front());
+                own.affine.pop_front();
+                own.affinePending--;
+                return true;
+            }
+            if (!own.tasks.empty()) {
+                task = move(own.tasks.back());
+                own.tasks.pop_back();
+                pending--;
+                return true;
+            }
+        }
+        size_t start = self >= 0 ? size_t(self) + 1 : 0;
+        for (size_t i = 0; i < queues.size(); i++) {
+            WorkQueue& victim = *queues[(start + i) % queues.size()];
+            lock_guard<mutex> lock(victim.m);
+            if (!victim.tasks.empty()) {
+                task = move(victim.tasks.front());
+                victim.tasks.pop_front();
+                pending--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Головний цикл робочого потоку
+    void workerLoop(int index) {
+        workerIndex() = index;
+        if (pinned) {
+            if (pinCurrentThread(unsigned(index))) {
+                pinSuccesses++;
+            }
+            pinAttempts++;
+        }
+        WorkQueue& own = *queues[index];
+        function<void()> task;
+        while (true) {
+            if (tryTake(task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            unique_lock<mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [&]() { return stopping || pending > 0 || own.affinePending > 0; });
+            if (stopping && pending == 0 && own.affinePending == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    // Створення пулу з заданою кількістю робочих потоків; pin - закріпити потік i за ядром i
+    explicit ThreadPool(unsigned count, bool pin = false) : pinned(pin) {
+        count = max(1u, count);
+        for (unsigned i = 0; i < count; i++) {
+            queues.push_back(make_unique<WorkQueue>());
+        }
+        for (unsigned i = 0; i < count; i++) {
+            threads.emplace_back(&ThreadPool::workerLoop, this, int(i));
+        }
+        while (pinned && pinAttempts < count) { // результат закріплення відомий до першої задачі
+            this_thread::yield();
+        }
+    }
+
+    // Завершення роботи: виконання всіх задач, що залишились, та очікування потоків
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (thread& t : threads) {
+            t.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Кількість робочих потоків
+    unsigned size() const {
+        return unsigned(threads.size());
+    }
+
+    // Кількість робочих потоків, які вдалося закріпити за ядрами
+    unsigned pinnedWorkers() const {
+        return pinSuccesses;
+    }
+
+    // Чи закріплені за ядрами всі робочі потоки (якщо хоч один не вдалося - розподіл з крадіжкою)
+    bool isPinned() const {
+        return pinned && pinSuccesses == threads.size();
+    }
+
+    // Надсилання задачі в пул; результат повертається через future
+    template <typename F>
+    auto submit(F f) -> future<decltype(f())> {
+        using R = decltype(f());
+        auto task = make_shared<packaged_task<R()>>(move(f));
+        future<R> result = task->get_future();
+        push([task]() { (*task)(); });
+        return result;
+    }
+
+    // Виконання однієї задачі з дек поточним потоком (допомога під час очікування)
+    bool runPendingTask() {
+        function<void()> task;
+        if (tryTake(task)) {
+            task();
+            return true;
+        }
+        return false;
+    }
+
+    // Паралельний цикл: body(lo, hi) для відрізків [begin, end) довжиною grain.
+    // Викликаючий потік сам виконує задачі, поки чекає, тому вкладені виклики не блокують пул
+    template <typename F>
+    void parallel_for(size_t begin, size_t end, size_t grain, F body) {
+        if (begin >= end) {
+            return;
+        }
+        grain = max<size_t>(1, grain);
+        size_t chunks = (end - begin + grain - 1) / grain;
+        if (chunks == 1) {
+            body(begin, end);       // маленька задача - без накладних витрат пулу
+            return;
+        }
+        atomic<size_t> remaining{chunks - 1};
+        mutex errorMutex;
+        exception_ptr error;
+        for (size_t c = 1; c < chunks; c++) {
+            size_t lo = begin + c * grain;
+            size_t hi = min(end, lo + grain);
+            push([&, lo, hi]() {
+                try {
+                    body(lo, hi);
+                } catch (...) {
+                    lock_guard<mutex> lock(errorMutex);
+                    if (!error) error = current_exception();
+                }
+                remaining--;
+            });
+        }
+        try {
+            body(begin, min(end, begin + grain)); // перший відрізок - у поточному потоці
+        } catch (...) {
+            lock_guard<mutex> lock(errorMutex);
+            if (!error) error = current_exception();
+        }
+        while (remaining > 0) {
+            if (!runPendingTask()) {
+                this_thread::yield();
+            }
+        }
+        if (error) {
+            rethrow_exception(error);
+        }
+    }
+
+    // Виконання f(worker, count) рівно один раз на кожному робочому потоці.
+    // Потрібно для статичного розподілу: відрізок w завжди обробляє той самий потік,
+    // тому сторінки, які він першим заповнив (first touch), лежать у його вузлі NUMA
+    template <typename F>
+    void forEachWorker(F f) {
+        unsigned count = size();
+        atomic<unsigned> remaining{count};
+        mutex errorMutex;
+        exception_ptr error;
+        for (unsigned w = 0; w < count; w++) {
+            pushAffine(w, [&, w]() {
+                try {
+                    f(w, count);
+                } catch (...) {
+                    lock_guard<mutex> lock(errorMutex);
+                    if (!error) error = current_exception();
+                }
+                remaining--;
+            });
+        }
+        while (remaining > 0) {
+            if (!runPendingTask()) {
+                this_thread::yield();
+            }
+        }
+        if (error) {
+            rethrow_exception(error);
+        }
+    }
+
+    // Паралельна редукція: map(lo, hi) для кожного відрізку, потім reduce у порядку відрізків
+    // (порядок об'єднання фіксований, тому результат не залежить від кількості потоків)
+    template <typename T, typename Map, typename Reduce>
+    T parallel_reduce(size_t begin, size_t end, size_t grain, T identity, Map map, Reduce reduce) {
+        if (begin >= end) {
+            return identity;
+        }
+        grain = max<size_t>(1, grain);
+        size_t chunks = (end - begin + grain - 1) / grain;
+        vector<T> partials(chunks, identity);
+        parallel_for(0, chunks, 1, [&](size_t lo, size_t hi) {
+            for (size_t c = lo; c < hi; c++) {
+                size_t from = begin + c * grain;
+                partials[c] = map(from, min(end, from + grain));
+            }
+        });
+        T result = identity;
+        for (const T& p : partials) {
+            result = reduce(result, p);
+        }
+        return result;
+    }
+};
+
+// ===================== Злита (fused) багатозапитна редукція =====================
+// Замість окремого потоку на кожен запит масив читається один раз: кожен робочий
+// потік обробляє свій суцільний відрізок блоками розміру BLOCK_SIZE, і поки блок
+// лежить у кеші, по ньому проходять усі запити (предикат + згортка).
+// Часткові результати рахуються для кожного блоку окремо і зливаються деревом у
+// фіксованому порядку, тому результат побітово однаковий за будь-якої кількості потоків.
+
+const size_t BLOCK_SIZE = 4096; // розмір блоку в елементах (32 КБ double - вміщується в кеш L1/L2)
+
+// Умова (предикат) відбору елементів для запиту
+enum class Predicate { Any, Greater, Less };
+
+// Операція згортки (редукції) для запиту
+enum class Reduction { Sum, Product, Count, Min, Max };
+
+// Опис одного запиту: предикат + редукція
+struct Query {
+    const char* name;   // назва запиту для виводу
+    Predicate pred;     // умова відбору елементів
+    double threshold;   // поріг для умови
+    Reduction op;       // операція згортки
+};
+
+// Частковий (або остаточний) результат одного запиту
+struct Partial {
+    NeumaierSum sum;            // акумулятор для Sum
+    ScaledProduct product;      // акумулятор для Product
+    double extremum = 0.0;      // акумулятор для Min/Max
+    size_t hits = 0;            // кількість елементів, що задовольнили умову (і результат Count)
+};
+
+// Нейтральний частковий результат для операції згортки
+Partial identityOf(Reduction op) {
+    Partial p;
+    if (op == Reduction::Min) {
+        p.extremum = numeric_limits<double>::infinity();
+    } else if (op == Reduction::Max) {
+        p.extremum = -numeric_limits<double>::infinity();
+    }
+    return p;
+}
+
+// Об'єднання двох часткових результатів однієї операції (a - лівіший відрізок масиву)
+Partial combine(Reduction op, const Partial& a, const Partial& b) {
+    Partial r = a;
+    r.hits += b.hits;
+    switch (op) {
+        case Reduction::Sum:     r.sum.merge(b.sum); break;
+        case Reduction::Product: r.product.merge(b.product); break;
+        case Reduction::Count:   break;
+        case Reduction::Min:     r.extremum = min(a.extremum, b.extremum); break;
+        case Reduction::Max:     r.extremum = max(a.extremum, b.extremum); break;
+    }
+    return r;
+}
+
+// Умови відбору: перевірка одного числа та (з SSE2) маска для пари чисел
+struct AnyPredicate {
+    bool operator()(double) const { return true; }
+#ifdef HAVE_SSE2
+    __m128d mask(__m128d) const { return _mm_castsi128_pd(_mm_set1_epi32(-1)); }
+#endif
+};
+
+struct GreaterPredicate {
+    double threshold;
+    bool operator()(double x) const { return x > threshold; }
+#ifdef HAVE_SSE2
+    __m128d mask(__m128d x) const { return _mm_cmpgt_pd(x, _mm_set1_pd(threshold)); }
+#endif
+};
+
+struct LessPredicate {
+    double threshold;
+    bool operator()(double x) const { return x < threshold; }
+#ifdef HAVE_SSE2
+    __m128d mask(__m128d x) const { return _mm_cmplt_pd(x, _mm_set1_pd(threshold)); }
+#endif
+};
+
+// Скалярний цикл по блоку: предикат і операція відомі на етапі компіляції,
+// тому компілятор може вбудувати їх у цикл (без SSE2, а також для хвоста блоку)
+template <typename Pred, typename Acc, typename Op>
+void reduceBlock(const double* data, size_t n, Pred pred, Acc& acc, size_t& hits, Op op) {
+    Acc local = acc;            // локальний акумулятор (у регістрах)
+    size_t count = hits;        // локальний лічильник збігів
+    for (size_t i = 0; i < n; i++) {
+        if (pred(data[i])) {    // перевірка умови запиту
+            op(local, data[i]);
+            count++;
+        }
+    }
+    acc = local;
+    hits = count;
+}
+
+#ifdef HAVE_SSE2
+// Векторні ядра без розгалужень на елемент: умова дає маску, за якою береться або саме
+// число, або нейтральний елемент (0, 1, +-inf), а збіги рахуються відніманням маски (-1).
+// Вісім незалежних доріжок (4 вектори по 2 числа) не чекають одна на одну і зливаються
+// у фіксованому порядку, тому результат блоку не залежить від кількості потоків
+const size_t VECTOR_LANES = 8;  // доріжок у ядрі
+const size_t RUN_STEPS = 8;     // кроків множення доріжки між нормалізаціями мантиси
+
+// Виклик f(0..3) для кожного з чотирьох векторів; розгорнуто вручну, щоб доріжки були в регістрах
+template <typename F>
+inline void forEachVector(F f) {
+    f(0); f(1); f(2); f(3);
+}
+
+// Компенсоване додавання (2Sum) для пари доріжок
+inline void addCompensated(__m128d& sum, __m128d& compensation, __m128d x) {
+    __m128d t = _mm_add_pd(sum, x);
+    __m128d xPart = _mm_sub_pd(t, sum);
+    compensation = _mm_add_pd(compensation, _mm_add_pd(_mm_sub_pd(sum, _mm_sub_pd(t, xPart)), _mm_sub_pd(x, xPart)));
+    sum = t;
+}
+
+// Вибір за маскою: a там, де маска, інакше b
+inline __m128d selectByMask(__m128d mask, __m128d a, __m128d b) {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+// Сума кількостей збігів з усіх доріжок
+inline size_t laneCount(const __m128i (&count)[4]) {
+    size_t total = 0;
+    forEachVector([&](int k) {
+        long long lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), count[k]);
+        total += size_t(lanes[0] + lanes[1]);
+    });
+    return total;
+}
+
+// Сума: кожна доріжка - окремий компенсований акумулятор
+template <typename Pred>
+void sumBlock(const double* data, size_t n, Pred pred, NeumaierSum& acc, size_t& hits) {
+    __m128d sum[4], compensation[4];
+    __m128i count[4];
+    forEachVector([&](int k) {
+        sum[k] = compensation[k] = _mm_setzero_pd();
+        count[k] = _mm_setzero_si128();
+    });
+    size_t full = n - n % VECTOR_LANES;
+    for (size_t i = 0; i < full; i += VECTOR_LANES) {
+        forEachVector([&](int k) {
+            __m128d x = _mm_loadu_pd(data + i + 2 * k);
+            __m128d hit = pred.mask(x);
+            addCompensated(sum[k], compensation[k], _mm_and_pd(hit, x));   // x або 0
+            count[k] = _mm_sub_epi64(count[k], _mm_castpd_si128(hit));
+        });
+    }
+    forEachVector([&](int k) {
+        double s[2], c[2];
+        _mm_storeu_pd(s, sum[k]);
+        _mm_storeu_pd(c, compensation[k]);
+        acc.merge(NeumaierSum{ s[0], c[0] });
+        acc.merge(NeumaierSum{ s[1], c[1] });
+    });
+    hits += laneCount(count);
+    reduceBlock(data + full, n - full, pred, acc, hits, [](NeumaierSum& s, double x) { s.add(x); });
+}
+
+// Добуток: кожна доріжка множить RUN_STEPS множників звичайним множенням, а потім
+// переносить порядок мантиси в цілий лічильник бітовими операціями (мантиса знову в [1, 2)).
+// Це точно, поки всі множники за модулем у [2^-64, 2^64]: 8 кроків не виходять за межі double.
+// Інакше (0, денормалізовані, дуже великі, inf, NaN) блок перераховується точним ScaledProduct::mul
+template <typename Pred>
+void productBlock(const double* data, size_t n, Pred pred, ScaledProduct& acc, size_t& hits) {
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d magnitudeMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    const __m128i mantissaMask = _mm_set1_epi64x(0x800FFFFFFFFFFFFFLL);
+    const __m128i zeroExponent = _mm_set1_epi64x(0x3FF0000000000000LL);
+    __m128d mantissa[4], smallest[4], largest[4], notANumber[4];
+    __m128i exponent[4], count[4];
+    forEachVector([&](int k) {
+        notANumber[k] = _mm_setzero_pd();
+        mantissa[k] = one;
+        smallest[k] = _mm_set1_pd(HUGE_VAL);
+        largest[k] = _mm_setzero_pd();
+        exponent[k] = count[k] = _mm_setzero_si128();
+    });
+    size_t full = n - n % VECTOR_LANES;
+    for (size_t i = 0; i < full;) {
+        size_t runEnd = min(full, i + RUN_STEPS * VECTOR_LANES);
+        for (; i < runEnd; i += VECTOR_LANES) {
+            forEachVector([&](int k) {
+                __m128d x = _mm_loadu_pd(data + i + 2 * k);
+                __m128d hit = pred.mask(x);
+                __m128d factor = selectByMask(hit, x, one);          // x або 1
+                __m128d magnitude = _mm_and_pd(factor, magnitudeMask);
+                mantissa[k] = _mm_mul_pd(mantissa[k], factor);
+                smallest[k] = _mm_min_pd(magnitude, smallest[k]);
+                largest[k] = _mm_max_pd(magnitude, largest[k]);
+                count[k] = _mm_sub_epi64(count[k], _mm_castpd_si128(hit));
+            });
+        }
+        forEachVector([&](int k) {
+            notANumber[k] = _mm_or_pd(notANumber[k], _mm_cmpunord_pd(mantissa[k], mantissa[k])); // множник NaN
+            __m128i bits = _mm_castpd_si128(mantissa[k]);
+            __m128i field = _mm_and_si128(_mm_srli_epi64(bits, 52), _mm_set1_epi64x(0x7FF));
+            exponent[k] = _mm_add_epi64(exponent[k], _mm_sub_epi64(field, _mm_set1_epi64x(1023)));
+            mantissa[k] = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, mantissaMask), zeroExponent));
+        });
+    }
+    int outOfRange = 0;
+    forEachVector([&](int k) {
+        outOfRange |= _mm_movemask_pd(_mm_cmplt_pd(smallest[k], _mm_set1_pd(0x1p-64)));
+        outOfRange |= _mm_movemask_pd(_mm_cmpgt_pd(largest[k], _mm_set1_pd(0x1p64)));
+        outOfRange |= _mm_movemask_pd(notANumber[k]);
+    });
+    if (outOfRange) {
+        reduceBlock(data, n, pred, acc, hits, [](ScaledProduct& s, double x) { s.mul(x); });
+        return;
+    }
+    forEachVector([&](int k) {
+        double m[2];
+        long long e[2];
+        _mm_storeu_pd(m, mantissa[k]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(e), exponent[k]);
+        for (int lane = 0; lane < 2; lane++) {
+            ScaledProduct part;
+            part.mantissa = m[lane];
+            part.exponent = e[lane];
+            acc.merge(part);
+        }
+    });
+    hits += laneCount(count);
+    reduceBlock(data + full, n - full, pred, acc, hits, [](ScaledProduct& s, double x) { s.mul(x); });
+}
+
+// Кількість, мінімум або максимум: pick(x, best) - _mm_min_pd/_mm_max_pd, що, як і
+// скалярне x < best ? x : best, ігнорують NaN; нейтральний елемент уже лежить в acc
+template <typename Pred, typename Pick, typename ScalarOp>
+void extremumBlock(const double* data, size_t n, Pred pred, double& acc, size_t& hits, Pick pick, ScalarOp op) {
+    __m128d best[4];
+    __m128i count[4];
+    forEachVector([&](int k) {
+        best[k] = _mm_set1_pd(acc);
+        count[k] = _mm_setzero_si128();
+    });
+    size_t full = n - n % VECTOR_LANES;
+    for (size_t i = 0; i < full; i += VECTOR_LANES) {
+        forEachVector([&](int k) {
+            __m128d x = _mm_loadu_pd(data + i + 2 * k);
+            __m128d hit = pred.mask(x);
+            best[k] = pick(selectByMask(hit, x, best[k]), best[k]);
+            count[k] = _mm_sub_epi64(count[k], _mm_castpd_si128(hit));
+        });
+    }
+    forEachVector([&](int k) {
+        double b[2];
+        _mm_storeu_pd(b, best[k]);
+        op(acc, b[0]);
+        op(acc, b[1]);
+    });
+    hits += laneCount(count);
+    reduceBlock(data + full, n - full, pred, acc, hits, op);
+}
+
+// Вибір операції згортки для вже визначеного предиката
+template <typename Pred>
+void applyWithPredicate(const Query& q, const double* data, size_t n, Pred pred, Partial& p) {
+    switch (q.op) {
+        case Reduction::Sum:
+            sumBlock(data, n, pred, p.sum, p.hits); break;
+        case Reduction::Product:
+            productBlock(data, n, pred, p.product, p.hits); break;
+        case Reduction::Count:
+            extremumBlock(data, n, pred, p.extremum, p.hits, [](__m128d, __m128d best) { return best; },
+                          [](double&, double) {}); break;
+        case Reduction::Min:
+            extremumBlock(data, n, pred, p.extremum, p.hits, [](__m128d x, __m128d best) { return _mm_min_pd(x, best); },
+                          [](double& a, double x) { a = x < a ? x : a; }); break;
+        case Reduction::Max:
+            extremumBlock(data, n, pred, p.extremum, p.hits, [](__m128d x, __m128d best) { return _mm_max_pd(x, best); },
+                          [](double& a, double x) { a = x > a ? x : a; }); break;
+    }
+}
+#else
+// Вибір операції згортки для вже визначеного предиката
+template <typename Pred>
+void applyWithPredicate(const Query& q, const double* data, size_t n, Pred pred, Partial& p) {
+    switch (q.op) {
+        case Reduction::Sum:
+            reduceBlock(data, n, pred, p.sum, p.hits, [](NeumaierSum& s, double x) { s.add(x); }); break;
+        case Reduction::Product:
+            reduceBlock(data, n, pred, p.product, p.hits, [](ScaledProduct& s, double x) { s.mul(x); }); break;
+        case Reduction::Count:
+            reduceBlock(data, n, pred, p.extremum, p.hits, [](double&, double) {}); break;
+        case Reduction::Min:
+            reduceBlock(data, n, pred, p.extremum, p.hits, [](double& a, double x) { a = x < a ? x : a; }); break;
+        case Reduction::Max:
+            reduceBlock(data, n, pred, p.extremum, p.hits, [](double& a, double x) { a = x > a ? x : a; }); break;
+    }
+}
+#endif
+
+// Застосування одного запиту до блоку даних
+void applyQuery(const Query& q, const double* data, size_t n, Partial& p) {
+    switch (q.pred) {
+        case Predicate::Any:
+            applyWithPredicate(q, data, n, AnyPredicate{}, p); break;
+        case Predicate::Greater:
+            applyWithPredicate(q, data, n, GreaterPredicate{ q.threshold }, p); break;
+        case Predicate::Less:
+            applyWithPredicate(q, data, n, LessPredicate{ q.threshold }, p); break;
+    }
+}
+
+// Кількість блоків для масиву з n елементів
+size_t blockCount(size_t n) {
+    return (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+// Кількість блоків в одній задачі: відрізок займає половину кешу L2
+size_t chunkBlocks() {
+    return max<size_t>(1, cacheInfo().l2 / 2 / (BLOCK_SIZE * sizeof(double)));
+}
+
+// Розподіл блоків [0, blocks) між потоками пулу; body(firstBlock, lastBlock).
+// Якщо потоки закріплені за ядрами - статично: потік w завжди отримує той самий суцільний
+// відрізок (і при заповненні, і при читанні), тож дані лишаються в його вузлі NUMA.
+// Інакше - динамічно з крадіжкою задач, задачами розміром з половину L2
+template <typename F>
+void scheduleBlocks(ThreadPool& pool, size_t blocks, F body) {
+    size_t grain = chunkBlocks();
+    if (pool.isPinned()) {
+        pool.forEachWorker([&](unsigned w, unsigned count) {
+            size_t first = blocks * w / count;
+            size_t last = blocks * (w + 1) / count;
+            for (size_t b = first; b < last; b += grain) {
+                body(b, min(last, b + grain));
+            }
+        });
+    } else {
+        grain = min(grain, max<size_t>(1, blocks / (4 * pool.size()))); // не менше 4 задач на потік
+        pool.parallel_for(0, blocks, grain, body);
+    }
+}
+
+// Обробка блоків [firstBlock, lastBlock): усі запити по кожному блоку, поки він у кеші.
+// Результат блоку b для запиту q записується в partials[b * queries.size() + q]
+void fusedReduceBlocks(const double* data, size_t n, size_t firstBlock, size_t lastBlock,
+                       const vector<Query>& queries, vector<Partial>& partials) {
+    const size_t qn = queries.size();
+    for (size_t b = firstBlock; b < lastBlock; b++) {
+        size_t begin = b * BLOCK_SIZE;
+        size_t len = min(BLOCK_SIZE, n - begin); // довжина поточного блоку
+        for (size_t q = 0; q < qn; q++) {
+            Partial p = identityOf(queries[q].op);
+            applyQuery(queries[q], data + begin, len, p);
+            partials[b * qn + q] = p;
+        }
+    }
+}
+
+// Злиття часткових результатів блоків попарним деревом у фіксованому порядку:
+// (0,1), (2,3), ... потім (0,2), (4,6), ... - порядок не залежить від кількості потоків
+vector<Partial> treeMerge(const vector<Query>& queries, vector<Partial>& partials, size_t blocks) {
+    const size_t qn = queries.size();
+    for (size_t step = 1; step < blocks; step *= 2) {
+        for (size_t b = 0; b + step < blocks; b += 2 * step) {
+            for (size_t q = 0; q < qn; q++) {
+                partials[b * qn + q] = combine(queries[q].op, partials[b * qn + q], partials[(b + step) * qn + q]);
+            }
+        }
+    }
+    vector<Partial> result;
+    for (size_t q = 0; q < qn; q++) {
+        result.push_back(blocks > 0 ? partials[q] : identityOf(queries[q].op));
+    }
+    return result;
+}
+
+// Записи журналу про хід злитої редукції (по чвертях оброблених блоків)
+const char* const PROGRESS_TEXT[4] = {
+    "оброблено 25% блоків", "оброблено 50% блоків", "оброблено 75% блоків", "оброблено 100% блоків"
+};
+
+// Злита редукція: один прохід по пам'яті для всіх запитів, блоки розподіляються між потоками пулу.
+// Якщо задано logSource, робочий потік, чия задача перетнула чверть усіх блоків, сам публікує
+// запис журналу в канал (без блокувань - лише атомарний лічильник оброблених блоків)
+vector<Partial> fusedReduce(ThreadPool& pool, const double* data, size_t n, const vector<Query>& queries,
+                            const char* logSource = nullptr) {
+    size_t blocks = blockCount(n);
+    vector<Partial> partials(blocks * queries.size());   // часткові результати кожного блоку
+    atomic<size_t> doneBlocks{0};                       // скільки блоків уже оброблено
+    scheduleBlocks(pool, blocks, [&](size_t first, size_t last) {
+        fusedReduceBlocks(data, n, first, last, queries, partials);
+        if (logSource) {
+            size_t before = doneBlocks.fetch_add(last - first);
+            size_t after = before + (last - first);
+            for (size_t quarter = before * 4 / blocks; quarter < after * 4 / blocks; quarter++) {
+                publishLog(logSource, PROGRESS_TEXT[quarter]);
+            }
+        }
+    });
+    return treeMerge(queries, partials, blocks);
+}
+
+// ===================== Паралельна генерація випадкових даних =====================
+// Генератор на основі лічильника: i-те число залежить лише від (seed, i), тому кожен
+// потік незалежно заповнює свій відрізок, а результат для заданого seed однаковий
+// за будь-якої кількості потоків (на відміну від одного послідовного mt19937).
+
+// Перемішування 64-бітного лічильника (фіналізатор SplitMix64)
+inline uint64_t splitMix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// i-те випадкове число з рівномірного розподілу [low, high) для потоку з ключем seed
+inline double uniformAt(uint64_t seed, uint64_t i, double low, double high) {
+    // Стан SplitMix64 після i кроків: ключ + i * золотий крок (сам крок додає splitMix64).
+    // Ключ - перемішаний seed, тож різні seed дають різні підпотоки, а не перестановки одного
+    uint64_t bits = splitMix64(splitMix64(seed) + i * 0x9E3779B97F4A7C15ULL);
+    double unit = double(bits >> 11) * 0x1p-53;         // 53 старших біти -> [0, 1)
+    return low + (high - low) * unit;
+}
+
+// Заповнення масиву паралельно: кожна задача пулу генерує свій суцільний відрізок.
+// Розподіл той самий, що й у редукції, тому при закріплених потоках це і є first touch
+void generateParallel(ThreadPool& pool, double* data, size_t n, uint64_t seed, double low, double high) {
+    scheduleBlocks(pool, blockCount(n), [=](size_t first, size_t last) {
+        size_t hi = min(n, last * BLOCK_SIZE);
+        for (size_t i = first * BLOCK_SIZE; i < hi; i++) {
+            data[i] = uniformAt(seed, i, low, high);
+        }
+    });
+}
+
+// Для порівняння: та сама злита редукція, але з новим std::thread на кожен відрізок
+vector<Partial> fusedReduceSpawn(const double* data, size_t n, const vector<Query>& queries, unsigned workers) {
+    workers = max(1u, workers);
+    size_t blocks = blockCount(n);
+    vector<Partial> partials(blocks * queries.size());
+    vector<thread> threads;
+    size_t slice = (blocks + workers - 1) / workers;    // кількість блоків на потік
+
+    for (unsigned w = 0; w < workers; w++) {
+        size_t first = min(blocks, w * slice);
+        size_t last = min(blocks, first + slice);
+        threads.emplace_back(fusedReduceBlocks, data, n, first, last, cref(queries), ref(partials));
+    }
+    for (thread& t : threads) {
+        t.join();
+    }
+    return treeMerge(queries, partials, blocks);
+}
+
+// Для порівняння: окрема задача на кожен запит, кожна читає весь масив
+vector<Partial> perQueryReduce(ThreadPool& pool, const double* data, size_t n, const vector<Query>& queries) {
+    size_t blocks = blockCount(n);
+    vector<Partial> partials(blocks * queries.size());
+    vector<future<void>> tasks;
+    for (size_t q = 0; q < queries.size(); q++) {
+        tasks.push_back(pool.submit([&, q]() {
+            for (size_t b = 0; b < blocks; b++) {
+                size_t begin = b * BLOCK_SIZE;
+                Partial p = identityOf(queries[q].op);
+                applyQuery(queries[q], data + begin, min(BLOCK_SIZE, n - begin), p);
+                partials[b * queries.size() + q] = p;
+            }
+        }));
+    }
+    for (future<void>& t : tasks) {
+        t.get();
+    }
+    return treeMerge(queries, partials, blocks);
+}
+
+// Остаточне значення запиту (добуток без жодного збігу дорівнює 0, як у потоці T1)
+double finalValue(const Query& q, const Partial& p) {
+    if (p.hits == 0 && q.op != Reduction::Sum && q.op != Reduction::Count) {
+        return 0.0;
+    }
+    switch (q.op) {
+        case Reduction::Sum:     return p.sum.value();
+        case Reduction::Product: return p.product.value();
+        case Reduction::Count:   return double(p.hits);
+        default:                 return p.extremum;
+    }
+}
+
+// Текстове представлення результату (добуток - без переповнення типу double)
+string formatResult(const Query& q, const Partial& p) {
+    if (q.op == Reduction::Product && p.hits > 0) {
+        return p.product.toString();
+    }
+    ostringstream oss;
+    oss << fixed << setprecision(q.op == Reduction::Count ? 0 : 2) << finalValue(q, p);
+    return oss.str();
+}
+
+// Запис каналу з результатом запиту
+Record resultRecord(const char* source, const Query& q, const Partial& p) {
+    Record r;
+    r.source = source;
+    r.text = q.name;
+    r.value = finalValue(q, p);
+    r.precision = q.op == Reduction::Count ? 0 : 2;
+    if (q.op == Reduction::Sum) {
+        r.kind = RecordKind::Sum;
+    } else if (q.op == Reduction::Product) {
+        r.kind = RecordKind::Product;
+        r.product = p.product;
+        if (p.hits == 0) {
+            r.product.mantissa = 0.0; // немає жодного множника - добуток 0, як у потоці T1
+        }
+    } else {
+        r.kind = RecordKind::Value;
+    }
+    return r;
+}
+
+// Стандартний набір запитів варіанту 10 та додаткова статистика
+vector<Query> defaultQueries() {
+    return {
+        { "Сума чисел більших за 15",   Predicate::Greater, 15.0, Reduction::Sum },
+        { "Добуток чисел менших за 10", Predicate::Less,    10.0, Reduction::Product },
+        { "Кількість елементів",        Predicate::Any,      0.0, Reduction::Count },
+        { "Мінімум",                    Predicate::Any,      0.0, Reduction::Min },
+        { "Максимум",                   Predicate::Any,      0.0, Reduction::Max },
+    };
+}
+
+// Доповнення рядка пробілами до ширини width символів (setw рахує байти, а не літери UTF-8)
+string padRight(const string& text, size_t width) {
+    size_t letters = 0;
+    for (unsigned char c : text) {
+        if ((c & 0xC0) != 0x80) {   // не байт-продовження багатобайтового символу
+            letters++;
+        }
+    }
+    return text + string(letters < width ? width - letters : 1, ' ');
+}
+
+// Вимірювання часу виконання функції у мілісекундах (найкращий з кількох запусків)
+template <typename F>
+double measureMs(F f, int repeats = 3) {
+    double best = numeric_limits<double>::infinity();
+    for (int r = 0; r < repeats; r++) {
+        auto start = chrono::steady_clock::now();
+        f();
+        auto stop = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double, milli>(stop - start).count());
+    }
+    return best;
+}
+
+// Порівняння "потік на запит" та злитої редукції для різної кількості запитів
+void runBenchmark(ThreadPool& pool, size_t n) {
+    cout << "=== Порівняння: потік на запит vs злита редукція ===" << endl;
+    cout << "Розмір масиву: " << n << " (" << fixed << setprecision(1)
+         << n * sizeof(double) / (1024.0 * 1024.0) << " МБ), потоків: " << pool.size() << endl;
+
+    vector<Query> all = defaultQueries();
+    cout << "Запитів   Потік на запит, мс    Злита редукція, мс    Прискорення" << endl;
+    for (size_t count = 1; count <= all.size(); count++) {
+        vector<Query> queries(all.begin(), all.begin() + count);
+        double perQuery = measureMs([&]() { perQueryReduce(pool, arr.data(), n, queries); });
+        double fused = measureMs([&]() { fusedReduce(pool, arr.data(), n, queries); });
+        cout << left << setw(10) << count << setw(22) << fixed << setprecision(2) << perQuery
+             << setw(22) << fused << setprecision(2) << perQuery / fused << "x" << endl;
+    }
+
+    // Пул потоків проти створення нового потоку на кожну задачу (багато маленьких масивів)
+    const int iterations = 2000;                 // кількість повторів маленької задачі
+    const size_t small = min<size_t>(n, 4 * BLOCK_SIZE); // маленький масив: кілька блоків
+    cout << endl << "=== Пул потоків vs новий потік на задачу (" << iterations << " повторів) ===" << endl;
+    cout << "Задача                          Новий потік, мс       Пул, мс               Прискорення" << endl;
+    double spawnEmpty = measureMs([&]() {
+        for (int i = 0; i < iterations; i++) {
+            thread t([]() {});
+            t.join();
+        }
+    }, 1);
+    double poolEmpty = measureMs([&]() {
+        for (int i = 0; i < iterations; i++) {
+            pool.submit([]() {}).get();
+        }
+    }, 1);
+    cout << left << padRight("порожня задача", 32) << setw(22) << fixed << setprecision(2) << spawnEmpty
+         << setw(22) << poolEmpty << spawnEmpty / poolEmpty << "x" << endl;
+    double spawnReduce = measureMs([&]() {
+        for (int i = 0; i < iterations; i++) {
+            fusedReduceSpawn(arr.data(), small, all, pool.size());
+        }
+    }, 1);
+    double poolReduce = measureMs([&]() {
+        for (int i = 0; i < iterations; i++) {
+            fusedReduce(pool, arr.data(), small, all);
+        }
+    }, 1);
+    cout << left << padRight("редукція, " + to_string(small) + " ел.", 32) << setw(22) << fixed << setprecision(2)
+         << spawnReduce << setw(22) << poolReduce << spawnReduce / poolReduce << "x" << endl;
+
+    // Відтворюваність: результат не повинен залежати від кількості потоків
+    ThreadPool single(1);
+    vector<Partial> reference = fusedReduce(single, arr.data(), n, all);
+    bool identical = true;
+    for (unsigned t = 2; t <= max(8u, pool.size()); t++) {
+        ThreadPool other(t);
+        vector<Partial> result = fusedReduce(other, arr.data(), n, all);
+        for (size_t q = 0; q < all.size(); q++) {
+            identical = identical && formatResult(all[q], reference[q]) == formatResult(all[q], result[q])
+                        && finalValue(all[q], reference[q]) == finalValue(all[q], result[q]);
+        }
+    }
+    cout << endl << "Результати для 1.." << max(8u, pool.size()) << " потоків збігаються побітово: "
+         << (identical ? "так" : "ні") << endl;
+    for (size_t q = 0; q < all.size(); q++) {
+        cout << "  " << all[q].name << " = " << formatResult(all[q], reference[q]) << endl;
+    }
+}
+
+// Пропускна здатність у ГБ/с для n чисел double за ms мілісекунд
+double gigabytesPerSecond(size_t n, double ms) {
+    return n * sizeof(double) / (ms * 1e-3) / 1e9;
+}
+
+// Сильне (фіксований масив) та слабке (фіксований масив на потік) масштабування ядер суми та добутку
+void runScalingBenchmark(size_t n, unsigned maxThreads, bool pin) {
+    const CacheInfo& cache = cacheInfo();
+    cout << "=== Масштабування редукцій (ГБ/с) ===" << endl;
+    cout << "Кеші: L1 " << cache.l1 / 1024 << " КБ, L2 " << cache.l2 / 1024 << " КБ, L3 "
+         << cache.l3 / 1024 << " КБ; задача - " << chunkBlocks() << " блоків по " << BLOCK_SIZE
+         << " чисел; потоки " << (pin ? "закріплюються (статичний розподіл, first touch)" : "не закріплені (крадіжка задач)") << endl;
+    size_t perThread = max<size_t>(BLOCK_SIZE, n / maxThreads); // розмір на потік для слабкого масштабування
+    cout << "Сильне: " << n << " чисел; слабке: " << perThread << " чисел на потік" << endl;
+    cout << "Потоків  Сильне: сума   Сильне: добуток   Слабке: сума   Слабке: добуток" << endl;
+
+    vector<Query> sum = { defaultQueries()[0] };
+    vector<Query> product = { defaultQueries()[1] };
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2) {
+        counts.push_back(t);
+    }
+    counts.push_back(maxThreads);
+
+    for (unsigned t : counts) {
+        ThreadPool pool(t, pin);
+        double rates[4];
+        size_t sizes[2] = { n, perThread * t };
+        for (int mode = 0; mode < 2; mode++) {
+            DoubleArray data(sizes[mode]);          // нові сторінки: їх першим торкнеться generateParallel
+            generateParallel(pool, data.data(), data.size(), 42, 0.0, 50.0);
+            double sumMs = measureMs([&]() { fusedReduce(pool, data.data(), data.size(), sum); });
+            double productMs = measureMs([&]() { fusedReduce(pool, data.data(), data.size(), product); });
+            rates[mode * 2] = gigabytesPerSecond(data.size(), sumMs);
+            rates[mode * 2 + 1] = gigabytesPerSecond(data.size(), productMs);
+        }
+        cout << left << setw(9) << t << fixed << setprecision(2) << setw(15) << rates[0] << setw(18) << rates[1]
+             << setw(15) << rates[2] << rates[3];
+        if (pin && !pool.isPinned()) {
+            cout << "  (закріплено " << pool.pinnedWorkers() << " з " << t << " потоків - крадіжка задач)";
+        }
+        cout << endl;
+    }
+}
+
+// Кількість елементів в одній задачі parallel_reduce для T0 та T1 (як у злитій редукції)
+size_t perQueryGrain() {
+    return BLOCK_SIZE * chunkBlocks();
+}
+
+// Функція для потоку T0 - знаходження суми чисел більших за 15.
+// Масив ділиться на відрізки між потоками пулу, часткові суми зливаються в порядку відрізків
+void thread_T0(ThreadPool& pool) {
+    publishLog("Потік T0", "початок обчислення суми");
+    NeumaierSum local_sum = pool.parallel_reduce(0, arr.size(), perQueryGrain(), NeumaierSum(),
+        [](size_t lo, size_t hi) {
+            NeumaierSum part;     // компенсована сума відрізка (без накопичення похибки округлення)
+            for (size_t i = lo; i < hi; i++) {
+                if (arr[i] > 15.0) {  // перевірка умови: число більше за 15
+                    part.add(arr[i]); // додавання числа до суми
+                }
+            }
+            return part;
+        },
+        [](NeumaierSum a, const NeumaierSum& b) { a.merge(b); return a; });
+    publishLog("Потік T0", "прохід завершено");
+    
+    // Публікація результату в канал (без м'ютекса і без очікування на вивід)
+    Record r;
+    r.kind = RecordKind::Sum;
+    r.source = "Потік T0";
+    r.text = "Сума чисел більших за 15";
+    r.value = local_sum.value();
+    channel.publish(r);
+}
+
+// Функція для потоку T1 - знаходження добутку чисел менших за 10 (відрізками, як і T0)
+void thread_T1(ThreadPool& pool) {
+    publishLog("Потік T1", "початок обчислення добутку");
+    Partial total = pool.parallel_reduce(0, arr.size(), perQueryGrain(), identityOf(Reduction::Product),
+        [](size_t lo, size_t hi) {
+            Partial part;       // добуток відрізка у вигляді мантиса * 2^порядок та кількість множників
+            for (size_t i = lo; i < hi; i++) {
+                if (arr[i] < 10.0) {    // перевірка умови: число менше за 10
+                    part.product.mul(arr[i]); // множення числа на добуток
+                    part.hits++;
+                }
+            }
+            return part;
+        },
+        [](const Partial& a, const Partial& b) { return combine(Reduction::Product, a, b); });
+    ScaledProduct local_product = total.product;
+    bool found = total.hits > 0; // чи знайдено хоч одне число менше за 10
+    local_product.normalize();
+    publishLog("Потік T1", found ? "прохід завершено" : "прохід завершено, чисел менших за 10 немає");
     
     // Якщо не знайдено жодного числа менше 10, добуток дорівнює 0
     if (!found) {
-        local_product = 0.0;
+        local_product.mantissa = 0.0;
     }
     
-    product_result = local_product; // збереження результату в глобальну змінну
-    
-    // Синхронізований вивід результату
-    lock_guard<mutex> lock(mtx);    // блокування м'ютекса для безпечного виводу
-    cout << "Потік T1 : Добуток чисел менших за 10 = " << fixed << setprecision(2) << product_result << endl;
+    // Публікація результату в канал (без м'ютекса і без очікування на вивід)
+    Record r;
+    r.kind = RecordKind::Product;
+    r.source = "Потік T1";
+    r.text = "Добуток чисел менших за 10";
+    r.product = local_product;
+    channel.publish(r);
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     // Встановлення кодування для правильного відображення українських символів
     setlocale(LC_ALL, "");
     
+    // Параметри командного рядка
+    size_t n = 10;                                  // розмір масиву
+    unsigned workers = max(1u, thread::hardware_concurrency()); // кількість робочих потоків
+    bool perQuery = false;                          // режим "потік на запит" (T0 та T1)
+    bool bench = false;                             // режим порівняння продуктивності
+    bool scaling = false;                           // режим вимірювання масштабування
+    bool pin = false;                               // закріплення потоків за ядрами (NUMA)
+    random_device rd;                               // пристрій для отримання випадкового seed
+    uint64_t seed = (uint64_t(rd()) << 32) | rd();  // seed генератора (--seed для відтворюваності)
+    int verbose = -1;                               // вивід елементів: -1 - авто, 0 - ні, 1 - так
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            n = stoull(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            workers = max(1, stoi(argv[++i]));
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = stoull(argv[++i]);
+        } else if (arg == "--verbose") {
+            verbose = 1;
+        } else if (arg == "--quiet") {
+            verbose = 0;
+        } else if (arg == "--per-query") {
+            perQuery = true;
+        } else if (arg == "--bench") {
+            bench = true;
+        } else if (arg == "--scaling") {
+            scaling = true;
+        } else if (arg == "--pin") {
+            pin = true;
+        }
+    }
+    if ((bench || scaling) && n == 10) {
+        n = size_t(1) << 25;                        // 32M чисел (256 МБ) - значно більше за кеш
+    }
+    if (verbose < 0) {
+        verbose = n <= 100;                         // за замовчуванням елементи виводяться лише для малих масивів
+    }
+    
     cout << "=== Практична робота №10. Потоки (Варіант 10) ===" << endl;
     cout << "Студент: Пастух" << endl << endl;
     
-    // Ініціалізація генератора випадкових чисел
-    random_device rd;           // пристрій для отримання випадкового seed
-    mt19937 gen(rd());          // генератор Mersenne Twister
-    uniform_real_distribution<double> dis(0.0, 50.0); // рівномірний розподіл від 0 до 50
+    if (scaling) {
+        runScalingBenchmark(n, workers, pin);
+        return 0;
+    }
     
-    // Заповнення масиву випадковими числами
-    cout << "Ініціалізація масиву з 10 чисел типу double у проміжку (0..50):" << endl;
-    for (int i = 0; i < 10; i++) {
-        arr[i] = dis(gen);      // генерація випадкового числа
-        cout << "arr[" << i << "] = " << fixed << setprecision(2) << arr[i] << endl;
+    ThreadPool pool(workers, pin); // постійний пул потоків для всіх обчислень
+    if (pin && !pool.isPinned()) {
+        cout << "Увага: закріплено лише " << pool.pinnedWorkers() << " з " << pool.size()
+             << " потоків, використовується розподіл з крадіжкою задач" << endl;
+    }
+    
+    // Паралельне заповнення масиву випадковими числами з рівномірного розподілу (0..50)
+    arr.resize(n);
+    cout << "Ініціалізація масиву з " << n << " чисел типу double у проміжку (0..50), seed = " << seed << ":" << endl;
+    double generateMs = measureMs([&]() { generateParallel(pool, arr.data(), n, seed, 0.0, 50.0); }, 1);
+    if (verbose) {
+        for (size_t i = 0; i < n; i++) {
+            cout << "arr[" << i << "] = " << fixed << setprecision(2) << arr[i] << '\n';
+        }
+    } else {
+        cout << "Згенеровано за " << fixed << setprecision(2) << generateMs << " мс ("
+             << gigabytesPerSecond(n, generateMs) << " ГБ/с)" << '\n';
     }
     cout << endl;
     
-    // Створення та запуск потоків
-    cout << "Запуск потоків:" << endl;
-    thread t0(thread_T0);       // створення потоку T0
-    thread t1(thread_T1);       // створення потоку T1
+    if (bench) {
+        runBenchmark(pool, n);
+        return 0;
+    }
+    
+    channel.start();            // потік-споживач, що виводить результати
+    
+    if (perQuery) {
+        // Надсилання задач T0 та T1 у пул потоків
+        cout << "Запуск потоків:" << endl;
+        future<void> t0 = pool.submit([&]() { thread_T0(pool); }); // задача T0
+        future<void> t1 = pool.submit([&]() { thread_T1(pool); }); // задача T1
+        
+        // Очікування завершення задач
+        t0.get();                   // очікування завершення задачі T0
+        t1.get();                   // очікування завершення задачі T1
+    } else {
+        // Усі запити обчислюються за один прохід по масиву
+        cout << "Злита редукція (" << workers << " потоків, один прохід по масиву):" << endl;
+        vector<Query> queries = defaultQueries();
+        vector<Partial> results = fusedReduce(pool, arr.data(), n, queries, "Злита редукція");
+        for (size_t q = 0; q < queries.size(); q++) {
+            channel.publish(resultRecord("Злита редукція", queries[q], results[q]));
+        }
+    }
     
-    // Очікування завершення потоків
-    t0.join();                  // очікування завершення потоку T0
-    t1.join();                  // очікування завершення потоку T1
+    channel.stop();             // очікування виводу всіх записів; після цього результати готові
     
     cout << endl << "=== Результати обчислень ===" << endl;
     cout << "Сума чисел більших за 15: " << fixed << setprecision(2) << sum_result << endl;
-    cout << "Добуток чисел менших за 10: " << fixed << setprecision(2) << product_result << endl;
+    cout << "Добуток чисел менших за 10: " << product_result.toString() << endl;
     
     return 0;                   // завершення програми
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -8,6 +8,12 @@
 #include <sstream>      // Для обробки рядків як потоків
 #include <iomanip>      // Для форматування виведення
 #include <filesystem>   // Для роботи з файловою системою (C++17)
+#include <thread>       // Для паралельної аналітики
+#include <cstdint>      // Цілі типи фіксованого розміру
+#include <cmath>        // Для std::ceil
+#include <numeric>      // Для std::iota
+#include <unordered_map> // Хеш-таблиці індексів аналітики
+#include <string_view>  // Ключі без копіювання рядків
 
 // Структура для представлення футболіста (бомбардира)
 struct Player {
@@ -255,6 +261,414 @@ std::string formatMatchScore(const Match& match) {
     return oss.str();
 }
 
+// Доповнення рядка пробілами до ширини width символів (std::setw рахує байти, а кирилиця
+// в UTF-8 займає по два байти на літеру)
+std::string padRight(const std::string& text, size_t width) {
+    size_t length = 0;
+    for (unsigned char c : text) {
+        if ((c & 0xC0) != 0x80) ++length;
+    }
+    return length >= width ? text + " " : text + std::string(width - length, ' ');
+}
+
+// Рядок турнірної таблиці однієї команди
+struct TeamRecord {
+    std::string team;   // Команда (країна)
+    int played;         // Зіграно матчів
+    int wins;           // Перемоги
+    int draws;          // Нічиї
+    int losses;         // Поразки
+    int goalsFor;       // Забито
+    int goalsAgainst;   // Пропущено
+
+    // Конструктор з назвою команди
+    TeamRecord(const std::string& t)
+        : team(t), played(0), wins(0), draws(0), losses(0), goalsFor(0), goalsAgainst(0) {}
+
+    // Очки: 3 за перемогу, 1 за нічию
+    int points() const { return wins * 3 + draws; }
+
+    // Різниця забитих і пропущених
+    int goalDifference() const { return goalsFor - goalsAgainst; }
+};
+
+// Підсумок особистих зустрічей команди проти одного суперника
+struct HeadToHead {
+    int wins;           // Перемоги
+    int draws;          // Нічиї
+    int losses;         // Поразки
+    int goalsFor;       // Забито
+    int goalsAgainst;   // Пропущено
+
+    HeadToHead() : wins(0), draws(0), losses(0), goalsFor(0), goalsAgainst(0) {}
+
+    int played() const { return wins + draws + losses; }
+};
+
+// Матч, рахунок якого не збігається з кількістю записаних голів
+struct ScoreMismatch {
+    int matchIndex;     // Індекс матчу
+    int counted1;       // Голів першої команди у списку голів
+    int counted2;       // Голів другої команди у списку голів
+    int unassigned;     // Голів із командою, що не грала в матчі
+};
+
+// Турнірна таблиця та матриця особистих зустрічей. Команди отримують щільні індекси, тому
+// кожен матч обробляється за O(кількість голів), а новий матч просто додається через addMatch
+struct Standings {
+    std::map<std::string, int> teamIds;     // Індекс команди за назвою
+    std::vector<TeamRecord> teams;          // Рядки таблиці за індексом команди
+    std::vector<HeadToHead> matrix;         // capacity * capacity: рядок - команда, стовпець - суперник
+    int capacity;                           // Розмір сторони матриці
+    int matchCount;                         // Кількість оброблених матчів
+    std::vector<ScoreMismatch> mismatches;  // Матчі з розбіжностями рахунку та голів
+
+    Standings() : capacity(0), matchCount(0) {}
+
+    // Індекс команди; нова команда додається в таблицю, а матриця за потреби розширюється вдвічі
+    int teamId(const std::string& team) {
+        auto found = teamIds.find(team);
+        if (found != teamIds.end()) return found->second;
+        int id = static_cast<int>(teams.size());
+        teamIds.emplace(team, id);
+        teams.emplace_back(team);
+        if (id >= capacity) {
+            int newCapacity = std::max(8, capacity * 2);
+            std::vector<HeadToHead> grown(static_cast<size_t>(newCapacity) * newCapacity);
+            for (int row = 0; row < capacity; ++row) {
+                std::copy(matrix.begin() + row * capacity, matrix.begin() + (row + 1) * capacity,
+                          grown.begin() + row * newCapacity);
+            }
+            matrix.swap(grown);
+            capacity = newCapacity;
+        }
+        return id;
+    }
+
+    HeadToHead& headToHead(int team, int opponent) { return matrix[team * capacity + opponent]; }
+    const HeadToHead& headToHead(int team, int opponent) const { return matrix[team * capacity + opponent]; }
+
+    // Врахування одного матчу в таблиці, матриці та перевірці рахунку
+    void addMatch(const Match& match) {
+        int id1 = teamId(match.team1);
+        int id2 = teamId(match.team2);
+        TeamRecord& home = teams[id1];
+        TeamRecord& away = teams[id2];
+        HeadToHead& first = headToHead(id1, id2);
+        HeadToHead& second = headToHead(id2, id1);
+
+        home.played++;
+        away.played++;
+        home.goalsFor += match.score1;
+        home.goalsAgainst += match.score2;
+        away.goalsFor += match.score2;
+        away.goalsAgainst += match.score1;
+        first.goalsFor += match.score1;
+        first.goalsAgainst += match.score2;
+        second.goalsFor += match.score2;
+        second.goalsAgainst += match.score1;
+        if (match.score1 > match.score2) {
+            home.wins++; away.losses++;
+            first.wins++; second.losses++;
+        } else if (match.score1 < match.score2) {
+            home.losses++; away.wins++;
+            first.losses++; second.wins++;
+        } else {
+            home.draws++; away.draws++;
+            first.draws++; second.draws++;
+        }
+
+        // Перевірка рахунку за списком голів
+        int counted1 = 0, counted2 = 0, unassigned = 0;
+        for (const Goal& goal : match.goals) {
+            if (goal.team == match.team1) counted1++;
+            else if (goal.team == match.team2) counted2++;
+            else unassigned++;
+        }
+        if (counted1 != match.score1 || counted2 != match.score2 || unassigned != 0) {
+            mismatches.push_back({ matchCount, counted1, counted2, unassigned });
+        }
+        matchCount++;
+    }
+
+    // Врахування всіх матчів за один прохід
+    void addMatches(const std::vector<Match>& matches) {
+        for (const Match& match : matches) {
+            addMatch(match);
+        }
+    }
+
+    // Індекси команд у порядку місць: очки, різниця м'ячів, забиті, назва
+    std::vector<int> ranking() const {
+        std::vector<int> order(teams.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            const TeamRecord& x = teams[a];
+            const TeamRecord& y = teams[b];
+            if (x.points() != y.points()) return x.points() > y.points();
+            if (x.goalDifference() != y.goalDifference()) return x.goalDifference() > y.goalDifference();
+            if (x.goalsFor != y.goalsFor) return x.goalsFor > y.goalsFor;
+            return x.team < y.team;
+        });
+        return order;
+    }
+};
+
+// Параметри аналізу часу забитих голів
+const int MINUTE_SLOTS = 121;            // Хвилини 0..120 (пізніші зараховуються до 120-ї)
+const int BIN_WIDTH = 5;                 // Ширина інтервалу гістограми, хвилин
+const int REGULAR_BINS = 18;             // Інтервали 1-5, 6-10, ..., 86-90
+const int BIN_COUNT = REGULAR_BINS + 1;  // Останній інтервал - компенсований та додатковий час (90+)
+const int LATE_GOAL_MINUTE = 76;         // Гол з 76-ї хвилини вважається пізнім
+const size_t MIN_GOALS_PER_THREAD = 50000; // Менше голів на потік не варті окремого потоку
+
+// Розподіл голів за хвилинами для однієї команди, гравця або всього турніру
+struct MinuteDistribution {
+    const std::uint32_t* perMinute; // MINUTE_SLOTS лічильників (належать GoalTimeStats)
+    long long total;                // Загальна кількість голів
+
+    MinuteDistribution(const std::uint32_t* counts) : perMinute(counts), total(0) {
+        for (int m = 0; m < MINUTE_SLOTS; ++m) {
+            total += perMinute[m];
+        }
+    }
+
+    // Кількість голів у кожному 5-хвилинному інтервалі
+    std::vector<long long> bins() const {
+        std::vector<long long> result(BIN_COUNT, 0);
+        for (int m = 0; m < MINUTE_SLOTS; ++m) {
+            int bin = m == 0 ? 0 : std::min((m - 1) / BIN_WIDTH, REGULAR_BINS);
+            result[bin] += perMinute[m];
+        }
+        return result;
+    }
+
+    // Хвилина, до якої (включно) забито частку p голів (метод найближчого рангу)
+    int percentile(double p) const {
+        if (total == 0) return 0;
+        long long rank = std::max(1LL, static_cast<long long>(std::ceil(p * total)));
+        long long cumulative = 0;
+        for (int m = 0; m < MINUTE_SLOTS; ++m) {
+            cumulative += perMinute[m];
+            if (cumulative >= rank) return m;
+        }
+        return MINUTE_SLOTS - 1;
+    }
+
+    // Частка пізніх голів (з LATE_GOAL_MINUTE-ї хвилини)
+    double lateRatio() const {
+        if (total == 0) return 0.0;
+        long long late = 0;
+        for (int m = LATE_GOAL_MINUTE; m < MINUTE_SLOTS; ++m) {
+            late += perMinute[m];
+        }
+        return static_cast<double>(late) / total;
+    }
+};
+
+// Хешування гравця за покажчиком на нього (ключі вказують на гравців у matches)
+struct PlayerPtrHash {
+    size_t operator()(const Player* p) const {
+        size_t h = std::hash<std::string>()(p->surname);
+        h = h * 31 + std::hash<std::string>()(p->name);
+        return h * 31 + std::hash<int>()(p->number);
+    }
+};
+
+// Порівняння гравців за покажчиками (за значенням, а не за адресою)
+struct PlayerPtrEqual {
+    bool operator()(const Player* a, const Player* b) const { return *a == *b; }
+};
+
+// Гол у вигляді індексів команди та гравця
+struct GoalRecord {
+    int team;    // Індекс команди
+    int player;  // Індекс гравця
+    int minute;  // Хвилина (обмежена діапазоном 0..120)
+};
+
+// Частина голів, яку індексує один потік: власні щільні індекси команд і гравців у порядку
+// першої появи та голи, записані через ці локальні індекси. Голи одразу розкладаються за
+// потоком, який рахуватиме їхнього гравця (за хешем гравця - однаково в усіх потоках)
+struct GoalTimePartial {
+    std::unordered_map<std::string_view, int> teamIds;
+    std::unordered_map<const Player*, int, PlayerPtrHash, PlayerPtrEqual> playerIds;
+    std::vector<std::string_view> teams;   // Команди за локальним індексом
+    std::vector<const Player*> players;    // Гравці за локальним індексом
+    std::vector<int> playerTeam;           // Локальний індекс команди кожного гравця
+    std::vector<unsigned> playerOwner;     // Потік, що рахує голи кожного гравця
+    std::vector<std::vector<GoalRecord>> goals; // Голи з локальними індексами для кожного потоку
+
+    // Врахування одного голу
+    void add(const Goal& goal) {
+        auto team = teamIds.emplace(goal.team, static_cast<int>(teams.size()));
+        if (team.second) teams.push_back(goal.team);
+        auto player = playerIds.emplace(&goal.player, static_cast<int>(players.size()));
+        if (player.second) {
+            players.push_back(&goal.player);
+            playerTeam.push_back(team.first->second);
+            playerOwner.push_back(static_cast<unsigned>(PlayerPtrHash()(&goal.player) % goals.size()));
+        }
+        goals[playerOwner[player.first->second]].push_back(
+            { team.first->second, player.first->second, std::min(std::max(goal.minute, 0), MINUTE_SLOTS - 1) });
+    }
+};
+
+// Результат аналітики часу голів: лічильники за хвилинами для кожної команди та гравця
+struct GoalTimeStats {
+    std::vector<std::string> teams;          // Команди за індексом
+    std::vector<Player> players;             // Гравці за індексом
+    std::vector<int> playerTeam;             // Команда кожного гравця
+    std::vector<std::uint32_t> teamMinutes;  // teams.size() * MINUTE_SLOTS лічильників
+    std::vector<std::uint32_t> playerMinutes; // players.size() * MINUTE_SLOTS лічильників
+    std::vector<std::uint32_t> allMinutes;   // Лічильники для всього турніру
+    std::vector<long long> teamTotals;       // Кількість голів кожної команди
+    std::vector<long long> playerTotals;     // Кількість голів кожного гравця
+
+    MinuteDistribution team(int id) const { return MinuteDistribution(&teamMinutes[id * MINUTE_SLOTS]); }
+    MinuteDistribution player(int id) const { return MinuteDistribution(&playerMinutes[id * MINUTE_SLOTS]); }
+    MinuteDistribution overall() const { return MinuteDistribution(allMinutes.data()); }
+};
+
+// Запуск task(0..threadCount-1) у threadCount потоках (нульовий - у поточному)
+template <typename Task>
+void runInThreads(unsigned threadCount, Task task) {
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threadCount; ++t) {
+        workers.emplace_back(task, t);
+    }
+    task(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Аналітика часу голів у три етапи:
+// 1) паралельно: кожен потік індексує свій відрізок матчів (з приблизно однаковою кількістю
+//    голів) власними хеш-таблицями;
+// 2) послідовно: локальні індекси переводяться у спільні - робота пропорційна кількості різних
+//    команд і гравців у потоках, а не голів; порядок індексів - як при послідовному проході;
+// 3) паралельно: кожен потік рахує лише голи "своїх" гравців (відкладені для нього на етапі 1),
+//    тож кожен гол читається один раз; рядки гравців належать одному потоку і рахуються прямо
+//    у спільному масиві, а команди й весь турнір - у власних невеликих масивах потоку, які
+//    потім зливаються
+GoalTimeStats computeGoalTimeStats(const std::vector<Match>& matches, unsigned threadCount) {
+    // Кількість голів до кожного матчу - для рівного поділу роботи між потоками
+    std::vector<size_t> goalsBefore(matches.size() + 1, 0);
+    for (size_t i = 0; i < matches.size(); ++i) {
+        goalsBefore[i + 1] = goalsBefore[i] + matches[i].goals.size();
+    }
+    const size_t totalGoals = goalsBefore.back();
+    size_t usefulThreads = std::max<size_t>(1, totalGoals / MIN_GOALS_PER_THREAD);
+    threadCount = static_cast<unsigned>(std::min<size_t>(std::max(threadCount, 1u), usefulThreads));
+
+    // Етап 1: локальні індекси
+    std::vector<GoalTimePartial> partials(threadCount);
+    runInThreads(threadCount, [&](unsigned t) {
+        size_t from = std::lower_bound(goalsBefore.begin(), goalsBefore.end() - 1,
+                                       totalGoals * t / threadCount) - goalsBefore.begin();
+        size_t to = t + 1 == threadCount ? matches.size()
+                  : std::lower_bound(goalsBefore.begin(), goalsBefore.end() - 1,
+                                     totalGoals * (t + 1) / threadCount) - goalsBefore.begin();
+        partials[t].goals.resize(threadCount);
+        for (std::vector<GoalRecord>& bucket : partials[t].goals) {
+            bucket.reserve((goalsBefore[to] - goalsBefore[from]) / threadCount);
+        }
+        for (size_t i = from; i < to; ++i) {
+            for (const Goal& goal : matches[i].goals) {
+                partials[t].add(goal);
+            }
+        }
+    });
+
+    // Етап 2: локальні індекси -> спільні
+    GoalTimeStats stats;
+    std::unordered_map<std::string_view, int> teamIds;
+    std::unordered_map<const Player*, int, PlayerPtrHash, PlayerPtrEqual> playerIds;
+    std::vector<std::vector<int>> teamMap(threadCount), playerMap(threadCount);
+    for (unsigned t = 0; t < threadCount; ++t) {
+        const GoalTimePartial& part = partials[t];
+        for (std::string_view team : part.teams) {
+            auto id = teamIds.emplace(team, static_cast<int>(stats.teams.size()));
+            if (id.second) stats.teams.emplace_back(team);
+            teamMap[t].push_back(id.first->second);
+        }
+        for (size_t local = 0; local < part.players.size(); ++local) {
+            auto id = playerIds.emplace(part.players[local], static_cast<int>(stats.players.size()));
+            if (id.second) {
+                stats.players.push_back(*part.players[local]);
+                stats.playerTeam.push_back(teamMap[t][part.playerTeam[local]]);
+            }
+            playerMap[t].push_back(id.first->second);
+        }
+    }
+
+    // Етап 3: підрахунок, потік t читає лише відкладені для нього голи всіх частин
+    const int teamCount = static_cast<int>(stats.teams.size());
+    const int playerCount = static_cast<int>(stats.players.size());
+    stats.playerMinutes.assign(static_cast<size_t>(playerCount) * MINUTE_SLOTS, 0);
+    std::vector<std::vector<std::uint32_t>> threadTeamMinutes(threadCount), threadAllMinutes(threadCount);
+    runInThreads(threadCount, [&](unsigned t) {
+        std::vector<std::uint32_t>& teamMinutes = threadTeamMinutes[t];
+        std::vector<std::uint32_t>& allMinutes = threadAllMinutes[t];
+        teamMinutes.assign(static_cast<size_t>(teamCount) * MINUTE_SLOTS, 0);
+        allMinutes.assign(MINUTE_SLOTS, 0);
+        for (unsigned p = 0; p < threadCount; ++p) {
+            const std::vector<int>& teams = teamMap[p];
+            const std::vector<int>& players = playerMap[p];
+            for (const GoalRecord& goal : partials[p].goals[t]) {
+                teamMinutes[teams[goal.team] * MINUTE_SLOTS + goal.minute]++;
+                stats.playerMinutes[players[goal.player] * MINUTE_SLOTS + goal.minute]++;
+                allMinutes[goal.minute]++;
+            }
+        }
+    });
+
+    // Злиття масивів потоків
+    stats.teamMinutes.assign(static_cast<size_t>(teamCount) * MINUTE_SLOTS, 0);
+    stats.allMinutes.assign(MINUTE_SLOTS, 0);
+    for (unsigned t = 0; t < threadCount; ++t) {
+        for (size_t i = 0; i < stats.teamMinutes.size(); ++i) {
+            stats.teamMinutes[i] += threadTeamMinutes[t][i];
+        }
+        for (int m = 0; m < MINUTE_SLOTS; ++m) {
+            stats.allMinutes[m] += threadAllMinutes[t][m];
+        }
+    }
+
+    // Підсумки для сортування таблиць
+    for (int id = 0; id < teamCount; ++id) {
+        stats.teamTotals.push_back(stats.team(id).total);
+    }
+    for (int id = 0; id < playerCount; ++id) {
+        stats.playerTotals.push_back(stats.player(id).total);
+    }
+    return stats;
+}
+
+// Гістограма одним рядком: кожен 5-хвилинний інтервал - символ, тим "щільніший", чим більше голів
+std::string histogramLine(const std::vector<long long>& bins) {
+    static const std::string levels = " .:-=+*#";
+    long long maxCount = *std::max_element(bins.begin(), bins.end());
+    std::string line;
+    for (long long count : bins) {
+        size_t level = maxCount == 0 ? 0 : static_cast<size_t>((count * (levels.size() - 1) + maxCount - 1) / maxCount);
+        line += levels[level];
+    }
+    return line;
+}
+
+// Один рядок таблиці розподілу: кількість голів, процентилі, частка пізніх голів і гістограма
+void printDistributionRow(const MinuteDistribution& distribution) {
+    std::cout << std::setw(8) << distribution.total
+              << std::setw(6) << distribution.percentile(0.25)
+              << std::setw(6) << distribution.percentile(0.5)
+              << std::setw(6) << distribution.percentile(0.75)
+              << std::setw(6) << distribution.percentile(0.9)
+              << std::setw(10) << std::fixed << std::setprecision(1) << distribution.lateRatio() * 100.0
+              << "|" << histogramLine(distribution.bins()) << "|" << std::endl;
+}
+
 // Головна функція програми
 int main() {
     // Налаштування підтримки кирилиці в консолі
@@ -443,8 +857,153 @@ int main() {
     
     printHorizontalLine(TABLE_WIDTH, '=');
     
+    // Турнірна таблиця та особисті зустрічі (один прохід по матчах)
+    Standings standings;
+    standings.addMatches(matches);
+    std::vector<int> standingsOrder = standings.ranking();
+    
+    std::cout << "\n" << std::string(TABLE_WIDTH / 2 - 9, '=') << " ТУРНІРНА ТАБЛИЦЯ " << std::string(TABLE_WIDTH / 2 - 9, '=') << std::endl;
+    std::cout << std::left
+              << padRight("№", 5)
+              << padRight("Країна", 30)
+              << padRight("І", 5)
+              << padRight("В", 5)
+              << padRight("Н", 5)
+              << padRight("П", 5)
+              << padRight("М'ячі", 10)
+              << padRight("Різниця", 10)
+              << "Очки" << std::endl;
+    printHorizontalLine(TABLE_WIDTH, '-');
+    rank = 1;
+    for (int id : standingsOrder) {
+        const TeamRecord& record = standings.teams[id];
+        std::cout << std::left
+                  << std::setw(5) << rank++
+                  << padRight(record.team, 30)
+                  << std::setw(5) << record.played
+                  << std::setw(5) << record.wins
+                  << std::setw(5) << record.draws
+                  << std::setw(5) << record.losses
+                  << std::setw(10) << (std::to_string(record.goalsFor) + "-" + std::to_string(record.goalsAgainst))
+                  << std::setw(10) << ((record.goalDifference() > 0 ? "+" : "") + std::to_string(record.goalDifference()))
+                  << record.points() << std::endl;
+    }
+    printHorizontalLine(TABLE_WIDTH, '-');
+    
+    // Матриця особистих зустрічей: рахунок за всі матчі команди рядка проти команди стовпця
+    std::cout << "Особисті зустрічі (забито:пропущено команди рядка, стовпці - місця в таблиці)" << std::endl;
+    std::cout << padRight("", 5 + 20);
+    for (size_t column = 1; column <= standingsOrder.size(); ++column) {
+        std::cout << std::setw(6) << column;
+    }
+    std::cout << std::endl;
+    rank = 1;
+    for (int row : standingsOrder) {
+        std::cout << std::setw(5) << rank++ << padRight(standings.teams[row].team, 20);
+        for (int column : standingsOrder) {
+            const HeadToHead& meeting = standings.headToHead(row, column);
+            std::cout << std::setw(6) << (row == column ? "x" : meeting.played() == 0 ? "." :
+                         std::to_string(meeting.goalsFor) + ":" + std::to_string(meeting.goalsAgainst));
+        }
+        std::cout << std::endl;
+    }
+    printHorizontalLine(TABLE_WIDTH, '-');
+    
+    // Перевірка рахунків за списками голів
+    if (standings.mismatches.empty()) {
+        std::cout << "Перевірка рахунків: усі рахунки збігаються зі списками голів" << std::endl;
+    } else {
+        std::cout << "Перевірка рахунків: розбіжностей - " << standings.mismatches.size() << std::endl;
+        for (const ScoreMismatch& mismatch : standings.mismatches) {
+            const Match& match = matches[mismatch.matchIndex];
+            std::cout << "  [" << (mismatch.matchIndex + 1) << "] " << formatMatchScore(match)
+                      << ": за голами " << mismatch.counted1 << ":" << mismatch.counted2;
+            if (mismatch.unassigned != 0) {
+                std::cout << ", голів іншої команди - " << mismatch.unassigned;
+            }
+            std::cout << std::endl;
+        }
+    }
+    
+    printHorizontalLine(TABLE_WIDTH, '=');
+    
+    // Аналітика часу забитих голів
+    GoalTimeStats timeStats = computeGoalTimeStats(matches, std::thread::hardware_concurrency());
+    std::cout << "\n" << std::string(TABLE_WIDTH / 2 - 9, '=') << " ЧАС ЗАБИТИХ ГОЛІВ " << std::string(TABLE_WIDTH / 2 - 9, '=') << std::endl;
+    
+    // Гістограма всього турніру за 5-хвилинними інтервалами
+    std::vector<long long> overallBins = timeStats.overall().bins();
+    std::cout << std::left << padRight("Хвилини", 8);
+    for (int bin = 0; bin < REGULAR_BINS; ++bin) {
+        std::cout << std::setw(6) << (std::to_string(bin * BIN_WIDTH + 1) + "-" + std::to_string((bin + 1) * BIN_WIDTH));
+    }
+    std::cout << "90+" << std::endl;
+    std::cout << padRight("Голів", 8);
+    for (long long count : overallBins) {
+        std::cout << std::setw(6) << count;
+    }
+    std::cout << std::endl;
+    
+    printHorizontalLine(TABLE_WIDTH, '-');
+    std::cout << "P25-P90 - хвилини, до яких забито 25-90% голів; пізні - голи з " << LATE_GOAL_MINUTE
+              << "-ї хвилини; гістограма - інтервали по " << BIN_WIDTH << " хв. та 90+" << std::endl;
+    
+    // Розподіл по командах (за спаданням кількості голів)
+    std::vector<int> teamOrder(timeStats.teams.size());
+    std::iota(teamOrder.begin(), teamOrder.end(), 0);
+    std::sort(teamOrder.begin(), teamOrder.end(), [&](int a, int b) {
+        return timeStats.teamTotals[a] > timeStats.teamTotals[b];
+    });
+    
+    std::cout << std::left
+              << padRight("№", 5)
+              << padRight("Країна", 45)
+              << padRight("Голів", 8)
+              << "P25   P50   P75   P90   "
+              << padRight("Пізні, %", 10)
+              << "Гістограма" << std::endl;
+    printHorizontalLine(TABLE_WIDTH, '-');
+    rank = 1;
+    for (int id : teamOrder) {
+        std::cout << std::left << std::setw(5) << rank++ << padRight(timeStats.teams[id], 45);
+        printDistributionRow(timeStats.team(id));
+    }
+    printHorizontalLine(TABLE_WIDTH, '-');
+    
+    // Розподіл по гравцях (найрезультативніші)
+    const size_t TOP_PLAYERS = 20;
+    std::vector<int> playerOrder(timeStats.players.size());
+    std::iota(playerOrder.begin(), playerOrder.end(), 0);
+    std::sort(playerOrder.begin(), playerOrder.end(), [&](int a, int b) {
+        long long goalsA = timeStats.playerTotals[a];
+        long long goalsB = timeStats.playerTotals[b];
+        if (goalsA != goalsB) return goalsA > goalsB;
+        return timeStats.players[a] < timeStats.players[b];
+    });
+    if (playerOrder.size() > TOP_PLAYERS) playerOrder.resize(TOP_PLAYERS);
+    
+    std::cout << std::left
+              << padRight("№", 5)
+              << padRight("Гравець", 25)
+              << padRight("Країна", 20)
+              << padRight("Голів", 8)
+              << "P25   P50   P75   P90   "
+              << padRight("Пізні, %", 10)
+              << "Гістограма" << std::endl;
+    printHorizontalLine(TABLE_WIDTH, '-');
+    rank = 1;
+    for (int id : playerOrder) {
+        const Player& player = timeStats.players[id];
+        std::cout << std::left << std::setw(5) << rank++
+                  << padRight(player.surname + " " + player.name, 25)
+                  << padRight(timeStats.teams[timeStats.playerTeam[id]], 20);
+        printDistributionRow(timeStats.player(id));
+    }
+    
+    printHorizontalLine(TABLE_WIDTH, '=');
+    
     std::cout << "\nДякуємо за використання програми! Натисніть Enter для виходу...";
     std::cin.get();
     
     return 0;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -1,25 +1,761 @@
 #include <iostream>        // Підключаємо бібліотеку для роботи з потоками вводу/виводу
 #include <stdexcept>       // Підключаємо бібліотеку для роботи з винятками
+#include <memory>          // Підключаємо бібліотеку для allocator_traits
+#include <new>             // Підключаємо бібліотеку для operator new/delete
+#include <cstddef>         // Підключаємо бібліотеку для size_t та max_align_t
+#include <type_traits>     // Підключаємо бібліотеку для перевірки властивостей типів
+#include <string>          // Підключаємо бібліотеку для роботи з рядками
+#include <algorithm>       // Підключаємо бібліотеку алгоритмів (std::max)
+#include <chrono>          // Підключаємо бібліотеку для вимірювання часу
+#include <iomanip>         // Підключаємо бібліотеку для форматування виводу
+#include <forward_list>    // Підключаємо однозв'язний список STL (для порівняння)
+#include <utility>         // Підключаємо std::move, std::forward та std::in_place
+#include <atomic>          // Підключаємо атомарні змінні (лічильник виділень пам'яті)
+#include <cstdlib>         // Підключаємо malloc/free
+#include <iterator>        // Підключаємо теги та властивості ітераторів
+#include <functional>      // Підключаємо std::less
+#include <numeric>         // Підключаємо std::accumulate
+#include <thread>          // Підключаємо потоки
+#include <mutex>           // Підключаємо м'ютекси
+#include <vector>          // Підключаємо вектор
+#include <cstdint>         // Підключаємо цілі типи фіксованого розміру
+#include <list>            // Підключаємо двозв'язний список STL (для порівняння)
+#include <deque>           // Підключаємо дек STL (для порівняння)
+#include <cmath>           // Підключаємо std::isnan
+#include <limits>          // Підключаємо quiet_NaN
+#include <sstream>         // Підключаємо рядкові потоки (буфер виводу)
+#include <cstring>         // Підключаємо std::memcpy
 
+// Лічильник викликів глобального operator new - щоб показати, які операції не виділяють пам'ять
+std::atomic<std::size_t> g_allocations{0};                           // Кількість виділень пам'яті
+// Обсяг пам'яті, виділеної через operator new і ще не звільненої, та його максимум
+std::atomic<std::size_t> g_bytesInUse{0};                            // Зайнято байтів зараз
+std::atomic<std::size_t> g_peakBytes{0};                             // Найбільше значення g_bytesInUse
+
+// Перед кожним блоком зберігається його розмір, щоб operator delete знав, скільки звільнено
+constexpr std::size_t ALLOC_HEADER = alignof(std::max_align_t);      // Розмір заголовка (зберігає вирівнювання)
+
+void* operator new(std::size_t bytes) {                              // Глобальний operator new з підрахунком
+    g_allocations.fetch_add(1, std::memory_order_relaxed);           // Рахуємо виділення
+    if (void* raw = std::malloc(ALLOC_HEADER + bytes)) {             // Виділяємо пам'ять разом із заголовком
+        *static_cast<std::size_t*>(raw) = bytes;                     // Запам'ятовуємо розмір блоку
+        std::size_t inUse = g_bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes; // Зайнято тепер
+        std::size_t peak = g_peakBytes.load(std::memory_order_relaxed); // Поточний максимум
+        while (inUse > peak && !g_peakBytes.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+        }                                                            // Оновлюємо максимум, якщо перевищено
+        return static_cast<char*>(raw) + ALLOC_HEADER;               // Повертаємо пам'ять за заголовком
+    }                                                                // Кінець перевірки
+    throw std::bad_alloc();                                          // Пам'яті немає - виняток
+}                                                                    // Кінець operator new
+
+void operator delete(void* pointer) noexcept {                       // Глобальний operator delete
+    if (pointer == nullptr) {                                        // Видалення nullptr нічого не робить
+        return;                                                      // Виходимо
+    }                                                                // Кінець перевірки
+    void* raw = static_cast<char*>(pointer) - ALLOC_HEADER;          // Початок блоку із заголовком
+    g_bytesInUse.fetch_sub(*static_cast<std::size_t*>(raw), std::memory_order_relaxed); // Зменшуємо зайнятий обсяг
+    std::free(raw);                                                  // Звільняємо пам'ять
+}                                                                    // Кінець operator delete
+
+void operator delete(void* pointer, std::size_t) noexcept {          // Розмірний operator delete
+    operator delete(pointer);                                        // Розмір беремо із заголовка
+}                                                                    // Кінець operator delete
+
+// Пул блоків однакового розміру (slab + free-list): пам'ять виділяється шматками (slab),
+// а звільнені блоки повертаються у список вільних і використовуються знову. Сам пул живе
+// на початку власного шматка разом з першими блоками, тому короткий список робить одне
+// виділення пам'яті; наступні шматки зростають удвічі. Пул знищується разом з останнім
+// алокатором, що на нього посилається
+class NodePool {           // Оголошуємо клас пулу вузлів
+private:                   // Приватна секція класу
+    struct FreeBlock {     // Вільний блок - у ньому зберігається лише покажчик на наступний
+        FreeBlock* next;   // Наступний вільний блок
+    };
+    struct Slab {          // Заголовок шматка пам'яті, за ним ідуть блоки
+        Slab* next;        // Наступний шматок у списку
+    };
+
+    static constexpr std::size_t ALIGN = alignof(std::max_align_t); // Вирівнювання блоків
+    static constexpr std::size_t MAX_SLAB_BLOCKS = 4096;             // Найбільша кількість блоків у шматку
+    static constexpr std::size_t FIRST_BLOCKS = 2;                   // Блоків у власному шматку пулу
+
+    std::size_t blockSize;     // Розмір одного блоку (вирівняний)
+    std::size_t ownBlocks;     // Кількість блоків у власному шматку пулу
+    std::size_t nextSlabBlocks; // Кількість блоків у наступному шматку (зростає вдвічі)
+    FreeBlock* freeList;       // Список звільнених блоків
+    Slab* slabs;               // Список додаткових шматків (для звільнення)
+    char* cursor;              // Наступний ще не використаний блок поточного шматка
+    char* limit;               // Кінець поточного шматка
+    std::size_t slabCount;     // Кількість додаткових шматків
+    std::atomic<std::size_t> references; // Кількість алокаторів, що посилаються на пул
+
+    // Розмір заголовка шматка з урахуванням вирівнювання
+    static constexpr std::size_t headerSize() {             // Функція розміру заголовка
+        return (sizeof(Slab) + ALIGN - 1) / ALIGN * ALIGN;   // Округлюємо до вирівнювання
+    }                                                        // Кінець функції headerSize
+
+    // Розмір самого пулу у власному шматку з урахуванням вирівнювання
+    static constexpr std::size_t selfSize() {                // Функція розміру пулу
+        return (sizeof(NodePool) + ALIGN - 1) / ALIGN * ALIGN; // Округлюємо до вирівнювання
+    }                                                        // Кінець функції selfSize
+
+    // Розмір блоку для об'єктів розміру size
+    static constexpr std::size_t roundBlock(std::size_t size) { // Функція розміру блоку
+        return (std::max(size, sizeof(FreeBlock)) + ALIGN - 1) / ALIGN * ALIGN; // Вирівнюємо розмір
+    }                                                        // Кінець функції roundBlock
+
+    // Заголовок власного шматка - він стоїть перед пулом
+    Slab* ownSlab() noexcept {                               // Функція заголовка власного шматка
+        return reinterpret_cast<Slab*>(reinterpret_cast<char*>(this) - headerSize()); // Заголовок перед пулом
+    }                                                        // Кінець функції ownSlab
+
+    // Скидання курсора на блоки власного шматка (вони йдуть одразу за пулом)
+    void rewind() noexcept {                                 // Функція скидання курсора
+        cursor = reinterpret_cast<char*>(this) + selfSize(); // Блоки починаються після пулу
+        limit = cursor + blockSize * ownBlocks;              // Кінець власних блоків
+    }                                                        // Кінець функції rewind
+
+    // Пул створюється лише через create - у власному шматку пам'яті
+    NodePool(std::size_t size, std::size_t blocks)
+        : blockSize(roundBlock(size)), ownBlocks(blocks), nextSlabBlocks(4 * FIRST_BLOCKS),
+          freeList(nullptr), slabs(nullptr), cursor(nullptr), limit(nullptr),
+          slabCount(0), references(1) {
+        rewind();                                            // Першими видаються власні блоки
+    }
+
+    // Деструктор - повертає всі додаткові шматки глобальному алокатору
+    ~NodePool() {              // Початок деструктора
+        release();             // Звільняємо всі шматки
+    }                          // Кінець деструктора
+
+    // Виділення нового шматка у глобального алокатора
+    void grow() {                                            // Функція виділення нового шматка
+        if (nextSlabBlocks > (SIZE_MAX - headerSize()) / blockSize) { // Розмір шматка не вміщується в size_t
+            throw std::bad_alloc();                          // такого шматка виділити неможливо
+        }                                                    // Кінець перевірки переповнення
+        std::size_t bytes = headerSize() + blockSize * nextSlabBlocks; // Розмір шматка в байтах
+        Slab* slab = static_cast<Slab*>(::operator new(bytes)); // Один виклик malloc на багато вузлів
+        slab->next = slabs;                                  // Додаємо шматок у список
+        slabs = slab;                                        // Новий шматок стає першим
+        cursor = reinterpret_cast<char*>(slab) + headerSize(); // Блоки починаються після заголовка
+        limit = cursor + blockSize * nextSlabBlocks;         // Кінець блоків шматка
+        slabCount++;                                         // Збільшуємо лічильник шматків
+        if (nextSlabBlocks < MAX_SLAB_BLOCKS) {              // Якщо ще не досягли межі
+            nextSlabBlocks *= 2;                             // наступний шматок буде вдвічі більшим
+        }                                                    // Кінець перевірки межі
+    }                                                        // Кінець функції grow
+
+public:                    // Публічна секція класу
+    NodePool(const NodePool&) = delete;            // Пул не копіюється
+    NodePool& operator=(const NodePool&) = delete; // Пул не присвоюється
+
+    // Створення пулу для блоків розміру size: одне виділення на пул і щонайменше blocks блоків
+    static NodePool* create(std::size_t size, std::size_t blocks = FIRST_BLOCKS) { // Функція створення пулу
+        blocks = std::max(blocks, FIRST_BLOCKS);             // Не менше за звичайний перший шматок
+        std::size_t block = roundBlock(size);                // Розмір одного блоку
+        if (blocks > (SIZE_MAX - headerSize() - selfSize()) / block) { // Розмір шматка не вміщується в size_t
+            throw std::bad_alloc();                          // такого шматка виділити неможливо
+        }                                                    // Кінець перевірки переповнення
+        char* raw = static_cast<char*>(::operator new(headerSize() + selfSize() + block * blocks)); // Один шматок
+        return new (raw + headerSize()) NodePool(size, blocks); // Пул стоїть після заголовка шматка
+    }                                                        // Кінець функції create
+
+    // Новий алокатор посилається на пул
+    void retain() noexcept {                                 // Функція збільшення лічильника
+        references.fetch_add(1, std::memory_order_relaxed);  // Ще одне посилання
+    }                                                        // Кінець функції retain
+
+    // Алокатор більше не посилається на пул; останній знищує пул разом із власним шматком
+    void drop() noexcept {                                   // Функція зменшення лічильника
+        if (references.fetch_sub(1, std::memory_order_acq_rel) == 1) { // Якщо це було останнє посилання
+            Slab* own = ownSlab();                           // Запам'ятовуємо власний шматок
+            this->~NodePool();                               // Звільняємо додаткові шматки
+            ::operator delete(own);                          // і сам пул
+        }                                                    // Кінець перевірки
+    }                                                        // Кінець функції drop
+
+    // Чи посилається на пул більше одного алокатора
+    bool isShared() const noexcept {                         // Функція перевірки
+        return references.load(std::memory_order_acquire) > 1; // Порівнюємо лічильник
+    }                                                        // Кінець функції isShared
+
+    // Розмір блоку, який видає пул
+    std::size_t getBlockSize() const {  // Функція повернення розміру блоку
+        return blockSize;               // Повертаємо розмір блоку
+    }                                   // Кінець функції getBlockSize
+
+    // Кількість шматків пам'яті пулу разом із власним
+    std::size_t getSlabCount() const {  // Функція повернення кількості шматків
+        return slabCount + 1;           // Додаткові шматки і власний
+    }                                   // Кінець функції getSlabCount
+
+    // Видача одного блоку: спочатку зі списку вільних, потім з поточного шматка
+    void* allocate() {                       // Функція виділення блоку
+        if (freeList != nullptr) {           // Якщо є звільнений блок
+            FreeBlock* block = freeList;     // беремо перший вільний блок
+            freeList = block->next;          // і вилучаємо його зі списку
+            return block;                    // Повертаємо блок
+        }                                    // Кінець перевірки списку вільних
+        if (cursor == limit) {               // Якщо поточний шматок вичерпано
+            grow();                          // виділяємо новий
+        }                                    // Кінець перевірки шматка
+        void* block = cursor;                // Беремо наступний блок шматка
+        cursor += blockSize;                 // Зсуваємо курсор
+        return block;                        // Повертаємо блок
+    }                                        // Кінець функції allocate
+
+    // Повернення блоку у список вільних (без звернення до глобального алокатора)
+    void deallocate(void* pointer) {                      // Функція звільнення блоку
+        FreeBlock* block = static_cast<FreeBlock*>(pointer); // Блок стає вузлом списку вільних
+        block->next = freeList;                           // Додаємо його на початок списку
+        freeList = block;                                 // Блок стає першим вільним
+    }                                                     // Кінець функції deallocate
+
+    // Приєднання іншого пулу з тим самим розміром блоку разом з усією його пам'яттю, зокрема
+    // власним шматком: блоки, видані other, відтепер належать цьому пулу (для splice/merge
+    // між списками). Посилань на other більше бути не повинно - він знищується
+    void absorb(NodePool* other) {                // Функція приєднання іншого пулу
+        while (other->cursor != other->limit) {   // Невикористані блоки поточного шматка іншого пулу
+            deallocate(other->cursor);            // переходять у список вільних цього пулу
+            other->cursor += other->blockSize;    // Переходимо до наступного блоку
+        }                                         // Кінець циклу
+        while (other->freeList != nullptr) {      // Звільнені блоки іншого пулу
+            FreeBlock* block = other->freeList;   // Беремо перший вільний блок
+            other->freeList = block->next;        // Вилучаємо його зі списку іншого пулу
+            deallocate(block);                    // і додаємо до цього пулу
+        }                                         // Кінець циклу
+        while (other->slabs != nullptr) {         // Усі додаткові шматки іншого пулу
+            Slab* slab = other->slabs;            // Беремо перший шматок
+            other->slabs = slab->next;            // Вилучаємо його зі списку іншого пулу
+            slab->next = slabs;                   // і додаємо до цього пулу
+            slabs = slab;                         // Шматок стає першим
+            slabCount++;                          // Збільшуємо лічильник шматків
+        }                                         // Кінець циклу
+        Slab* own = other->ownSlab();             // Власний шматок іншого пулу
+        other->~NodePool();                       // Інший пул порожній - руйнуємо лише його об'єкт
+        own->next = slabs;                        // Його власний шматок з блоками
+        slabs = own;                              // стає звичайним шматком цього пулу
+        slabCount++;                              // Збільшуємо лічильник шматків
+    }                                             // Кінець функції absorb
+
+    // Підготовка щонайменше n блоків одним шматком (масове завантаження без зростання шматків)
+    void reserve(std::size_t n) {                      // Функція резервування блоків
+        std::size_t available = std::size_t(limit - cursor) / blockSize; // Невикористані блоки
+        if (available >= n) {                          // Якщо блоків уже досить
+            return;                                    // нічого не робимо
+        }                                              // Кінець перевірки
+        while (cursor != limit) {                      // Залишок поточного шматка
+            deallocate(cursor);                        // переходить у список вільних
+            cursor += blockSize;                       // Переходимо до наступного блоку
+        }                                              // Кінець циклу
+        std::size_t saved = nextSlabBlocks;            // Запам'ятовуємо звичайний розмір шматка
+        nextSlabBlocks = n;                            // Наступний шматок - рівно на n блоків
+        grow();                                        // Виділяємо його
+        nextSlabBlocks = saved;                        // Відновлюємо звичайне зростання
+    }                                                  // Кінець функції reserve
+
+    // Звільнення всіх додаткових шматків разом - O(кількість шматків), а не O(кількість вузлів);
+    // власний шматок лишається і знову видає свої блоки
+    void release() {                         // Функція звільнення всіх шматків
+        while (slabs != nullptr) {           // Поки є шматки
+            Slab* slab = slabs;              // Зберігаємо покажчик на поточний шматок
+            slabs = slabs->next;             // Переходимо до наступного
+            ::operator delete(slab);         // Повертаємо шматок глобальному алокатору
+        }                                    // Кінець циклу звільнення
+        freeList = nullptr;                  // Список вільних більше не дійсний
+        rewind();                            // Знову видаємо власні блоки
+        slabCount = 0;                       // Скидаємо лічильник шматків
+        nextSlabBlocks = 4 * FIRST_BLOCKS;   // Наступний шматок знову маленький
+    }                                        // Кінець функції release
+};                                           // Кінець класу NodePool
+
+// Алокатор у стилі STL поверх NodePool. Копії алокатора спільно використовують один пул,
+// а копія списку отримує власний пул (select_on_container_copy_construction)
 template <typename T>      // Оголошуємо параметризований шаблон з типом T
-class LinkedList {         // Оголошуємо клас однозв'язного списку
+class PoolAllocator {      // Оголошуємо клас алокатора
+private:                   // Приватна секція класу
+    template <typename U> friend class PoolAllocator; // Доступ до пулу алокаторів інших типів
+
+    NodePool* pool;        // Пул (створюється при першому виділенні), спільний для копій алокатора
+
+    // Чи обслуговує пул запит на n об'єктів типу T
+    bool fitsPool(std::size_t n) const {                       // Функція перевірки запиту
+        return n == 1 && alignof(T) <= alignof(std::max_align_t) // Лише по одному вузлу зі звичайним вирівнюванням
+               && (pool == nullptr || sizeof(T) <= pool->getBlockSize()); // і не більше за блок пулу
+    }                                                          // Кінець функції fitsPool
+
+public:                    // Публічна секція класу
+    using value_type = T;                                           // Тип елементів
+    using propagate_on_container_copy_assignment = std::false_type; // При копіюванні списку пул не копіюється
+    using propagate_on_container_move_assignment = std::true_type;  // При переміщенні вузли переходять разом з пулом
+    using propagate_on_container_swap = std::true_type;             // При обміні списків обмінюються і пули
+    using is_always_equal = std::false_type;                        // Різні пули - різні алокатори
+
+    PoolAllocator() noexcept : pool(nullptr) {}                     // Конструктор за замовчуванням (без виділення пам'яті)
+
+    // Копія алокатора - спільний пул
+    PoolAllocator(const PoolAllocator& other) noexcept : pool(other.pool) {
+        if (pool != nullptr) {                                      // Якщо пул існує
+            pool->retain();                                         // ще одне посилання на нього
+        }                                                           // Кінець перевірки
+    }
+
+    // Конструктор з алокатора іншого типу (для rebind) - спільний пул
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {
+        if (pool != nullptr) {                                      // Якщо пул існує
+            pool->retain();                                         // ще одне посилання на нього
+        }                                                           // Кінець перевірки
+    }
+
+    // Переміщення - пул переходить до нового алокатора
+    PoolAllocator(PoolAllocator&& other) noexcept : pool(other.pool) {
+        other.pool = nullptr;                                       // other лишається без пулу
+    }
+
+    // Присвоєння копією або переміщенням (через обмін)
+    PoolAllocator& operator=(PoolAllocator other) noexcept {        // Оператор присвоєння
+        std::swap(pool, other.pool);                                // Старий пул відпустить other
+        return *this;                                               // Повертаємо алокатор
+    }                                                               // Кінець оператора присвоєння
+
+    // Деструктор - відпускає пул (останній алокатор знищує його)
+    ~PoolAllocator() {                                              // Початок деструктора
+        if (pool != nullptr) {                                      // Якщо пул існує
+            pool->drop();                                           // відпускаємо посилання
+        }                                                           // Кінець перевірки
+    }                                                               // Кінець деструктора
+
+    // Копія списку отримує новий, власний пул
+    PoolAllocator select_on_container_copy_construction() const { // Функція вибору алокатора для копії
+        return PoolAllocator();                                    // Повертаємо алокатор з новим пулом
+    }                                                              // Кінець функції
+
+    // Виділення пам'яті для n об'єктів
+    T* allocate(std::size_t n) {                                // Функція виділення пам'яті
+        if (!fitsPool(n)) {                                     // Якщо запит не для пулу
+            if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) { // Якщо T вирівняний сильніше за звичайний new
+                return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T)))); // вирівняний new
+            }                                                   // Кінець перевірки вирівнювання
+            return static_cast<T*>(::operator new(n * sizeof(T))); // звертаємось до глобального алокатора
+        }                                                       // Кінець перевірки
+        if (pool == nullptr) {                                  // Якщо пул ще не створено
+            pool = NodePool::create(sizeof(T));                 // створюємо його разом з першими блоками
+        }                                                       // Кінець перевірки пулу
+        return static_cast<T*>(pool->allocate());               // Беремо блок з пулу
+    }                                                           // Кінець функції allocate
+
+    // Звільнення пам'яті для n об'єктів
+    void deallocate(T* pointer, std::size_t n) noexcept {   // Функція звільнення пам'яті
+        if (!fitsPool(n) || pool == nullptr) {              // Якщо пам'ять не з пулу
+            if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) { // Пам'ять з вирівняного new
+                ::operator delete(pointer, std::align_val_t(alignof(T))); // повертаємо вирівняним delete
+            } else {                                        // Інакше
+                ::operator delete(pointer);                 // повертаємо її глобальному алокатору
+            }                                               // Кінець перевірки вирівнювання
+        } else {                                            // Інакше
+            pool->deallocate(pointer);                      // повертаємо блок у пул
+        }                                                   // Кінець перевірки
+    }                                                       // Кінець функції deallocate
+
+    // Чи можна звільнити весь пул разом: вузли беруться з пулу (а не з глобального алокатора)
+    // і пулом користується лише цей алокатор
+    bool canRelease() const noexcept {                        // Функція перевірки
+        return fitsPool(1) && (pool == nullptr || !pool->isShared()); // Вузли з пулу, пул не спільний
+    }                                                         // Кінець функції canRelease
+
+    // Звільнення всіх шматків пулу разом (усі вузли мають бути вже зруйновані)
+    void release() noexcept {                 // Функція звільнення пулу
+        if (pool != nullptr) {                // Якщо пул існує
+            pool->release();                  // звільняємо всі його шматки
+        }                                     // Кінець перевірки
+    }                                         // Кінець функції release
+
+    // Прийняття всієї пам'яті алокатора other: після цього вузли, виділені other, можна
+    // звільняти через цей алокатор. Можливо, лише якщо пул other більше ніхто не використовує
+    bool adopt(PoolAllocator& other) {                          // Функція прийняття пулу
+        if (pool == other.pool) {                               // Якщо пул уже спільний
+            return true;                                        // нічого робити не треба
+        }                                                       // Кінець перевірки
+        if (!other.canRelease()) {                              // Якщо пул other спільний з іншими
+            return false;                                       // забирати його не можна
+        }                                                       // Кінець перевірки
+        if (other.pool == nullptr) {                            // Якщо other нічого не виділяв
+            return true;                                        // приймати нічого
+        }                                                       // Кінець перевірки
+        if (pool == nullptr) {                                  // Якщо власного пулу ще немає
+            pool = other.pool;                                  // просто забираємо пул other
+            other.pool = nullptr;                               // other лишається без пулу
+        } else if (pool->getBlockSize() == other.pool->getBlockSize()) { // Якщо розміри блоків однакові
+            pool->absorb(other.pool);                           // приєднуємо пул other з усіма шматками
+            other.pool = nullptr;                               // other лишається без пулу
+        } else {                                                // Інакше
+            return false;                                       // пули несумісні
+        }                                                       // Кінець перевірки
+        return true;                                            // Пул прийнято
+    }                                                           // Кінець функції adopt
+
+    // Підготовка пулу до виділення n вузлів підряд одним шматком пам'яті
+    void reserve(std::size_t n) {                               // Функція резервування
+        if (n == 0 || !fitsPool(1)) {                           // Якщо резервувати нічого або вузли не з пулу
+            return;                                             // виходимо
+        }                                                       // Кінець перевірки
+        if (pool == nullptr) {                                  // Якщо пул ще не створено
+            pool = NodePool::create(sizeof(T), n);              // створюємо його одразу на n блоків
+            return;                                             // і більше нічого не потрібно
+        }                                                       // Кінець перевірки пулу
+        pool->reserve(n);                                       // Резервуємо блоки
+    }                                                           // Кінець функції reserve
+
+    // Кількість шматків у пулі (для демонстрації)
+    std::size_t slabCount() const noexcept {            // Функція повернення кількості шматків
+        return pool == nullptr ? 0 : pool->getSlabCount(); // Повертаємо кількість шматків
+    }                                                   // Кінець функції slabCount
+
+    // Алокатори рівні, якщо використовують один пул
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept { // Оператор порівняння
+        return pool == other.pool;                                   // Порівнюємо пули
+    }                                                                // Кінець оператора ==
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept { // Оператор нерівності
+        return !(*this == other);                                    // Заперечення рівності
+    }                                                                // Кінець оператора !=
+};                                                                   // Кінець класу PoolAllocator
+
+// Перевірка, чи вміє алокатор звільняти всю пам'ять разом (має release та canRelease)
+template <typename A, typename = void>
+struct HasBulkRelease : std::false_type {};       // За замовчуванням - ні
+template <typename A>
+struct HasBulkRelease<A, std::void_t<decltype(std::declval<A&>().release()),
+                                     decltype(std::declval<const A&>().canRelease())>>
+    : std::true_type {};                          // Якщо методи є - так
+
+// Перевірка, чи вміє алокатор приймати пам'ять іншого алокатора (має adopt)
+template <typename A, typename = void>
+struct HasAdopt : std::false_type {};             // За замовчуванням - ні
+template <typename A>
+struct HasAdopt<A, std::void_t<decltype(std::declval<A&>().adopt(std::declval<A&>()))>>
+    : std::true_type {};                          // Якщо метод є - так
+
+// Перевірка, чи вміє алокатор заздалегідь готувати пам'ять під n вузлів (має reserve)
+template <typename A, typename = void>
+struct HasReserve : std::false_type {};           // За замовчуванням - ні
+template <typename A>
+struct HasReserve<A, std::void_t<decltype(std::declval<A&>().reserve(std::size_t()))>>
+    : std::true_type {};                          // Якщо метод є - так
+
+// Вбудований буфер на N вузлів (малий буфер списку): вузли з нього не потребують виділення
+// пам'яті. Зайняті місця позначаються бітами маски, тому N - не більше 64
+template <typename NodeT, std::size_t N>
+class InlineNodeBuffer {   // Оголошуємо клас вбудованого буфера вузлів
+private:                   // Приватна секція класу
+    static_assert(N <= 64, "Вбудований буфер підтримує не більше 64 вузлів");
+    static constexpr std::uint64_t FULL = N == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << N) - 1; // Усі місця зайняті
+
+    alignas(NodeT) unsigned char storage[N * sizeof(NodeT)]; // Пам'ять під вузли
+    std::uint64_t used;                                      // Біт i - місце i зайняте
+
+    // Покажчик на місце з номером index
+    NodeT* slot(std::size_t index) {                                 // Функція отримання місця
+        return reinterpret_cast<NodeT*>(storage + index * sizeof(NodeT)); // Адреса місця
+    }                                                                // Кінець функції slot
+
+public:                    // Публічна секція класу
+    InlineNodeBuffer() noexcept : used(0) {}                    // Конструктор - усі місця вільні
+    InlineNodeBuffer(const InlineNodeBuffer&) = delete;          // Буфер не копіюється
+    InlineNodeBuffer& operator=(const InlineNodeBuffer&) = delete; // Буфер не присвоюється
+
+    // Чи лежить вузол у цьому буфері
+    bool owns(const NodeT* node) const noexcept {               // Функція перевірки належності
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(node); // Адреса вузла
+        std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(storage); // Початок буфера
+        return address >= begin && address < begin + sizeof(storage); // Адреса в межах буфера
+    }                                                           // Кінець функції owns
+
+    // Вільне місце під вузол або nullptr, якщо буфер заповнено
+    NodeT* take() noexcept {                                    // Функція взяття місця
+        if (used == FULL) {                                     // Якщо вільних місць немає
+            return nullptr;                                     // вузол піде в алокатор
+        }                                                       // Кінець перевірки
+        std::size_t index = 0;                                  // Номер першого вільного місця
+        while (used & (std::uint64_t(1) << index)) {            // Поки місце зайняте
+            index++;                                            // переходимо до наступного
+        }                                                       // Кінець пошуку
+        used |= std::uint64_t(1) << index;                      // Позначаємо місце зайнятим
+        return slot(index);                                     // Повертаємо його адресу
+    }                                                           // Кінець функції take
+
+    // Повернення місця вузла (вузол уже зруйновано)
+    void give(const NodeT* node) noexcept {                     // Функція звільнення місця
+        std::size_t index = std::size_t(reinterpret_cast<const unsigned char*>(node) - storage) / sizeof(NodeT); // Номер місця
+        used &= ~(std::uint64_t(1) << index);                   // Позначаємо місце вільним
+    }                                                           // Кінець функції give
+
+    bool inUse() const noexcept { return used != 0; }           // Чи зайняте хоч одне місце
+    void reset() noexcept { used = 0; }                         // Усі місця вільні (вузли вже зруйновано)
+
+    // Кількість вільних місць
+    std::size_t available() const noexcept {                    // Функція підрахунку вільних місць
+        std::size_t count = 0;                                  // Лічильник
+        for (std::size_t i = 0; i < N; i++) {                   // Для кожного місця
+            count += (used >> i & 1) == 0 ? 1 : 0;              // рахуємо вільні
+        }                                                       // Кінець циклу
+        return count;                                           // Повертаємо кількість
+    }                                                           // Кінець функції available
+};                                                              // Кінець класу InlineNodeBuffer
+
+// Без вбудованого буфера (N = 0) усі вузли беруться з алокатора
+template <typename NodeT>
+class InlineNodeBuffer<NodeT, 0> {                              // Порожній варіант буфера
+public:                                                         // Публічна секція класу
+    bool owns(const NodeT*) const noexcept { return false; }    // Жоден вузол не вбудований
+    NodeT* take() noexcept { return nullptr; }                  // Місць немає
+    void give(const NodeT*) noexcept {}                         // Повертати нічого
+    bool inUse() const noexcept { return false; }               // Буфер завжди вільний
+    void reset() noexcept {}                                    // Скидати нічого
+    std::size_t available() const noexcept { return 0; }        // Вільних місць немає
+};                                                              // Кінець класу InlineNodeBuffer<NodeT, 0>
+
+// Вузол списку - структура для зберігання елементів (поза класом списку, щоб буфер
+// вузлів міг бути базовим класом списку)
+template <typename T>
+struct ListNode {          // Оголошуємо структуру вузла
+    T data;                // Дані, що зберігаються у вузлі
+    ListNode* next;        // Покажчик на наступний вузол у списку
+    ListNode* prev;        // Покажчик на попередній вузол у списку
+
+    // Конструктор вузла: дані створюються на місці з переданих аргументів
+    template <typename... Args>
+    ListNode(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
+};
+
+// InlineNodes > 0 вмикає малий буфер: перші InlineNodes вузлів живуть у самому об'єкті списку,
+// і короткі списки не звертаються до алокатора зовсім. Кожне місце буфера - повний вузол
+// (елемент + покажчики next і prev), тобто sizeof(T) + 16 байт: для int порожній список займає
+// 32 байти, з N = 2 - 88 байт (два рядки кешу), а з N = 8 - 232 байти (майже чотири рядки).
+// Щоб об'єкт лишався в одному-двох рядках кешу, N варто брати 1-2 для int і 1 для більших T
+template <typename T, typename Alloc = PoolAllocator<T>, std::size_t InlineNodes = 0> // Параметризований шаблон з типом T, алокатором та розміром малого буфера
+class LinkedList           // Оголошуємо клас двозв'язного списку (O(1) операції на обох кінцях)
+    : private InlineNodeBuffer<ListNode<T>, InlineNodes> { // Малий буфер - базовий клас, при N = 0 він не займає місця
 private:                   // Приватна секція класу (недоступна ззовні)
-    // Вузол списку - внутрішня структура для зберігання елементів
-    struct Node {          // Оголошуємо структуру вузла
-        T data;            // Дані, що зберігаються у вузлі
-        Node* next;        // Покажчик на наступний вузол у списку
-        
-        // Конструктор вузла з ініціалізацією даних та обнуленням покажчика
-        Node(const T& value) : data(value), next(nullptr) {}
-    };
+    using Node = ListNode<T>;                         // Вузол списку
+    using LocalBuffer = InlineNodeBuffer<Node, InlineNodes>; // Вбудований буфер вузлів
+    
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>; // Алокатор вузлів
+    using NodeTraits = std::allocator_traits<NodeAlloc>;                                 // Властивості алокатора вузлів
     
     Node* head;            // Покажчик на перший елемент списку
     Node* tail;            // Покажчик на останній елемент списку
     size_t size;           // Змінна для зберігання кількості елементів у списку
+    NodeAlloc alloc;       // Алокатор, з якого беруться вузли
+    
+    static constexpr size_t IO_CHUNK = 4096; // Кількість елементів в одній порції вводу/виводу
+    
+    LocalBuffer& local() noexcept { return *this; }             // Вбудовані вузли (малий буфер)
+    const LocalBuffer& local() const noexcept { return *this; } // Вбудовані вузли (для читання)
+    
+    // Резервування пам'яті під n нових вузлів, якщо алокатор це вміє
+    void reserveNodes(size_t n) {                       // Функція резервування вузлів
+        if constexpr (HasReserve<NodeAlloc>::value) {   // Якщо алокатор має reserve
+            size_t inlineFree = local().available();      // Перші вузли підуть у вбудований буфер
+            alloc.reserve(n > inlineFree ? n - inlineFree : 0); // решту готуємо одним шматком
+        }                                               // Кінець перевірки
+    }                                                   // Кінець функції reserveNodes
+    
+    // Створення вузла через алокатор (елемент конструюється на місці з args)
+    template <typename... Args>
+    Node* createNode(Args&&... args) {                  // Функція створення вузла
+        Node* node = local().take();                      // Спершу - місце у вбудованому буфері
+        if (node == nullptr) {                          // Якщо буфер заповнено
+            node = NodeTraits::allocate(alloc, 1);      // виділяємо пам'ять під вузол
+        }                                               // Кінець перевірки
+        try {                                           // Якщо конструктор T викине виняток
+            NodeTraits::construct(alloc, node, std::in_place, std::forward<Args>(args)...); // Створюємо вузол у виділеній пам'яті
+        } catch (...) {                                 // то
+            releaseNodeMemory(node);                    // повертаємо пам'ять
+            throw;                                      // і передаємо виняток далі
+        }                                               // Кінець обробки винятку
+        return node;                                    // Повертаємо новий вузол
+    }                                                   // Кінець функції createNode
+    
+    // Повернення пам'яті вузла: у вбудований буфер або алокатору
+    void releaseNodeMemory(Node* node) {                // Функція звільнення пам'яті вузла
+        if (local().owns(node)) {                         // Якщо вузол вбудований
+            local().give(node);                           // звільняємо його місце
+        } else {                                        // Інакше
+            NodeTraits::deallocate(alloc, node, 1);     // повертаємо пам'ять алокатору
+        }                                               // Кінець перевірки
+    }                                                   // Кінець функції releaseNodeMemory
+    
+    // Знищення вузла та повернення пам'яті алокатору
+    void destroyNode(Node* node) {                      // Функція знищення вузла
+        NodeTraits::destroy(alloc, node);               // Викликаємо деструктор вузла
+        releaseNodeMemory(node);                        // Повертаємо пам'ять
+    }                                                   // Кінець функції destroyNode
+    
+    // Забрати всі вузли іншого списку (алокатор уже спільний або переданий)
+    void stealNodes(LinkedList& other) noexcept {       // Функція перенесення вузлів
+        head = other.head;                              // Беремо голову
+        tail = other.tail;                              // Беремо хвіст
+        size = other.size;                              // Беремо розмір
+        other.head = other.tail = nullptr;              // Інший список стає порожнім
+        other.size = 0;                                 // Обнуляємо його розмір
+    }                                                   // Кінець функції stealNodes
+    
+    // Переміщення елементів other у кінець цього списку по одному; other стає порожнім
+    void moveElementsFrom(LinkedList& other) {          // Функція поелементного переміщення
+        for (T& value : other) {                        // Для кожного елемента other
+            emplaceBack(std::move(value));              // переміщуємо його в новий вузол
+        }                                               // Кінець циклу
+        other.clear();                                  // Очищуємо other
+    }                                                   // Кінець функції moveElementsFrom
+    
+    // Чи можна перенести вузли іншого списку в цей без копіювання елементів
+    bool adoptNodesFrom(LinkedList& other) {            // Функція перевірки та прийняття пам'яті
+        if (other.local().inUse()) {                      // Вбудовані вузли other лишаються в other
+            return false;                               // тому - лише поелементно
+        }                                               // Кінець перевірки
+        if (alloc == other.alloc) {                     // Якщо алокатори рівні
+            return true;                                // вузли можна переносити
+        }                                               // Кінець перевірки
+        if constexpr (HasAdopt<NodeAlloc>::value) {     // Якщо алокатор вміє приймати чужу пам'ять
+            return alloc.adopt(other.alloc);            // пробуємо прийняти пул іншого списку
+        }                                               // Кінець перевірки
+        return false;                                   // Інакше - лише поелементно
+    }                                                   // Кінець функції adoptNodesFrom
+    
+    // Вставка вузла node після вузла position
+    void linkAfter(Node* position, Node* node) {        // Функція зв'язування вузла
+        node->prev = position;                          // Попередній для нового - position
+        node->next = position->next;                    // Наступний для нового - колишній наступний
+        if (position->next != nullptr) {                // Якщо position не був хвостом
+            position->next->prev = node;                // колишній наступний вказує назад на новий
+        } else {                                        // Інакше
+            tail = node;                                // новий вузол стає хвостом
+        }                                               // Кінець перевірки
+        position->next = node;                          // position вказує на новий вузол
+        size++;                                         // Збільшуємо лічильник елементів
+    }                                                   // Кінець функції linkAfter
+    
+    // Злиття двох відсортованих ланцюжків (лише покажчики next), стабільне
+    template <typename Compare>
+    static Node* mergeRuns(Node* left, Node* right, Compare& less) { // Функція злиття ланцюжків
+        Node* first = nullptr;                          // Перший вузол результату
+        Node** last = &first;                           // Куди записати наступний вузол результату
+        while (left != nullptr && right != nullptr) {   // Поки обидва ланцюжки непорожні
+            if (less(right->data, left->data)) {        // Якщо правий елемент менший
+                *last = right;                          // беремо правий
+                right = right->next;                    // і зсуваємо правий ланцюжок
+            } else {                                    // Інакше (рівні - лівий, для стабільності)
+                *last = left;                           // беремо лівий
+                left = left->next;                      // і зсуваємо лівий ланцюжок
+            }                                           // Кінець порівняння
+            last = &(*last)->next;                      // Переходимо до кінця результату
+        }                                               // Кінець циклу злиття
+        *last = left != nullptr ? left : right;         // Дописуємо залишок
+        return first;                                   // Повертаємо початок результату
+    }                                                   // Кінець функції mergeRuns
+    
+    // Сортування злиттям n вузлів, починаючи з cursor (cursor зсувається за відсортовану частину)
+    template <typename Compare>
+    static Node* sortRun(Node*& cursor, size_t n, Compare& less) { // Функція сортування ланцюжка
+        if (n == 1) {                                   // Один вузол уже відсортований
+            Node* node = cursor;                        // Беремо вузол
+            cursor = cursor->next;                      // Зсуваємо курсор
+            node->next = nullptr;                       // Відрізаємо вузол від решти
+            return node;                                // Повертаємо ланцюжок з одного вузла
+        }                                               // Кінець перевірки
+        Node* left = sortRun(cursor, n / 2, less);      // Сортуємо першу половину
+        Node* right = sortRun(cursor, n - n / 2, less); // Сортуємо другу половину
+        return mergeRuns(left, right, less);            // Зливаємо половини
+    }                                                   // Кінець функції sortRun
+    
+    // Відновлення покажчиків prev та tail після перестановки покажчиків next
+    void relinkPrev() {                                 // Функція відновлення зворотних зв'язків
+        Node* previous = nullptr;                       // Попередній вузол
+        for (Node* current = head; current != nullptr; current = current->next) { // Проходимо по списку
+            current->prev = previous;                   // Встановлюємо зворотний зв'язок
+            previous = current;                         // Запам'ятовуємо вузол
+        }                                               // Кінець циклу
+        tail = previous;                                // Останній вузол - хвіст
+    }                                                   // Кінець функції relinkPrev
     
 public:                     // Публічна секція класу (доступна ззовні)
+    using value_type = T;                                   // Тип елементів (як у контейнерах STL)
+    using allocator_type = Alloc;                           // Тип алокатора
+    
+    // Прямий (forward) ітератор; IsConst - чи дає лише читання елементів
+    template <bool IsConst>
+    class Iterator {                                        // Оголошуємо клас ітератора
+    private:                                                // Приватна секція класу
+        friend class LinkedList;                            // Список має доступ до вузла
+        Node* node;                                         // Поточний вузол (nullptr - кінець)
+        
+        explicit Iterator(Node* current) : node(current) {} // Конструктор з вузла
+        
+    public:                                                 // Публічна секція класу
+        using iterator_category = std::forward_iterator_tag; // Категорія ітератора
+        using value_type = T;                               // Тип елементів
+        using difference_type = std::ptrdiff_t;             // Тип відстані між ітераторами
+        using pointer = std::conditional_t<IsConst, const T*, T*>;   // Тип покажчика на елемент
+        using reference = std::conditional_t<IsConst, const T&, T&>; // Тип посилання на елемент
+        
+        Iterator() : node(nullptr) {}                       // Конструктор за замовчуванням
+        
+        // Перетворення змінного ітератора на константний
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) : node(other.node) {}
+        
+        reference operator*() const {                       // Розіменування
+            return node->data;                              // Повертаємо посилання на дані
+        }                                                   // Кінець оператора *
+        
+        pointer operator->() const {                        // Доступ до членів елемента
+            return &node->data;                             // Повертаємо покажчик на дані
+        }                                                   // Кінець оператора ->
+        
+        Iterator& operator++() {                            // Префіксний інкремент
+            node = node->next;                              // Переходимо до наступного вузла
+            return *this;                                   // Повертаємо себе
+        }                                                   // Кінець оператора ++
+        
+        Iterator operator++(int) {                          // Постфіксний інкремент
+            Iterator previous = *this;                      // Зберігаємо поточний стан
+            node = node->next;                              // Переходимо до наступного вузла
+            return previous;                                // Повертаємо попередній стан
+        }                                                   // Кінець оператора ++
+        
+        template <bool OtherConst>
+        bool operator==(const Iterator<OtherConst>& other) const { // Порівняння на рівність
+            return node == other.node;                      // Однакові, якщо вказують на один вузол
+        }                                                   // Кінець оператора ==
+        
+        template <bool OtherConst>
+        bool operator!=(const Iterator<OtherConst>& other) const { // Порівняння на нерівність
+            return node != other.node;                      // Різні, якщо вказують на різні вузли
+        }                                                   // Кінець оператора !=
+        
+        template <bool> friend class Iterator;              // Ітератори різної константності - друзі
+    };                                                      // Кінець класу Iterator
+    
+    using iterator = Iterator<false>;                       // Ітератор зі зміною елементів
+    using const_iterator = Iterator<true>;                  // Ітератор лише для читання
+    
     // Конструктор за замовчуванням - створює порожній список
-    LinkedList() : head(nullptr), tail(nullptr), size(0) {}
+    LinkedList() : head(nullptr), tail(nullptr), size(0), alloc() {}
+    
+    // Конструктор із заданим алокатором
+    explicit LinkedList(const Alloc& allocator) : head(nullptr), tail(nullptr), size(0), alloc(allocator) {}
+    
+    // Конструктор з діапазону [first, last) - ланцюжок будується за один прохід
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    LinkedList(InputIt first, InputIt last, const Alloc& allocator = Alloc())
+        : head(nullptr), tail(nullptr), size(0), alloc(allocator) {
+        append(first, last);         // Додаємо всі елементи діапазону
+    }                                // Кінець конструктора з діапазону
     
     // Деструктор - автоматично викликається при знищенні об'єкта
     ~LinkedList() {            // Початок деструктора
@@ -27,7 +763,9 @@ public:                     // Публічна секція класу (дос
     }                          // Кінець деструктора
     
     // Конструктор копіювання - створює копію існуючого списку
-    LinkedList(const LinkedList& other) : head(nullptr), tail(nullptr), size(0) {
+    LinkedList(const LinkedList& other)
+        : head(nullptr), tail(nullptr), size(0),
+          alloc(NodeTraits::select_on_container_copy_construction(other.alloc)) {
         Node* current = other.head;  // Покажчик для проходження по оригінальному списку
         while (current != nullptr) { // Поки не дійшли до кінця списку
             pushBack(current->data); // Додаємо елемент в кінець нового списку
@@ -35,31 +773,103 @@ public:                     // Публічна секція класу (дос
         }                            // Кінець циклу копіювання
     }                                // Кінець конструктора копіювання
     
-    // Оператор присвоєння - копіює дані з одного списку в інший
+    // Конструктор переміщення - забирає вузли та алокатор без жодного виділення пам'яті.
+    // Якщо other використовує вбудовані вузли, елементи переміщуються по одному
+    LinkedList(LinkedList&& other) noexcept(InlineNodes == 0)
+        : head(nullptr), tail(nullptr), size(0),
+          alloc(other.local().inUse() ? NodeAlloc(other.alloc) : NodeAlloc(std::move(other.alloc))) {
+        if (other.local().inUse()) {   // Якщо вузли other не можна забрати
+            moveElementsFrom(other); // переміщуємо елементи
+        } else {                     // Інакше
+            stealNodes(other);       // переносимо вузли
+        }                            // Кінець перевірки
+    }                                // Кінець конструктора переміщення
+    
+    // Оператор присвоєння - копіює дані з одного списку в інший, повторно використовуючи власні вузли
     LinkedList& operator=(const LinkedList& other) {
         if (this != &other) {        // Перевіряємо, чи не присвоюємо об'єкт сам собі
-            clear();                 // Очищуємо поточний список
-            Node* current = other.head; // Покажчик для проходження по оригінальному списку
-            while (current != nullptr) { // Поки не дійшли до кінця списку
-                pushBack(current->data); // Додаємо елемент в кінець поточного списку
+            if (NodeTraits::propagate_on_container_copy_assignment::value && alloc != other.alloc) { // Якщо алокатор копіюється
+                clear();                 // вузли старого алокатора треба повернути йому
+                alloc = other.alloc;     // і взяти алокатор іншого списку
+            }                            // Кінець перевірки алокатора
+            Node* target = head;         // Вузол цього списку, що отримає наступне значення
+            Node* current = other.head;  // Покажчик для проходження по оригінальному списку
+            while (target != nullptr && current != nullptr) { // Поки є і куди, і що копіювати
+                target->data = current->data; // Присвоюємо в наявний вузол (рядок може використати свій буфер)
+                target = target->next;   // Переходимо до наступного вузла цього списку
+                current = current->next; // Переходимо до наступного елемента
+            }                            // Кінець циклу присвоєння
+            while (current != nullptr) { // Якщо інший список довший
+                pushBack(current->data); // Додаємо решту елементів
                 current = current->next; // Переходимо до наступного елемента
-            }                            // Кінець циклу копіювання
+            }                            // Кінець циклу додавання
+            while (size > other.size) {  // Якщо цей список був довший
+                popBack();               // видаляємо зайві вузли з кінця
+            }                            // Кінець циклу видалення
         }                                // Кінець перевірки самоприсвоєння
         return *this;                    // Повертаємо посилання на поточний об'єкт
     }                                    // Кінець оператора присвоєння
     
+    // Оператор переміщення - забирає вузли іншого списку
+    LinkedList& operator=(LinkedList&& other) noexcept(NodeTraits::propagate_on_container_move_assignment::value
+                                                       && InlineNodes == 0) {
+        if (this != &other) {        // Перевіряємо, чи не присвоюємо об'єкт сам собі
+            clear();                 // Звільняємо власні вузли
+            if (other.local().inUse()) { // Якщо other використовує вбудовані вузли
+                moveElementsFrom(other); // переміщуємо елементи по одному
+            } else if (NodeTraits::propagate_on_container_move_assignment::value) { // Якщо алокатор переходить разом з вузлами
+                alloc = std::move(other.alloc); // беремо алокатор іншого списку
+                stealNodes(other);   // і його вузли
+            } else if (alloc == other.alloc) { // Якщо алокатори рівні
+                stealNodes(other);   // вузли можна просто забрати
+            } else {                 // Інакше вузли належать чужому алокатору
+                moveElementsFrom(other); // переміщуємо елементи по одному
+            }                        // Кінець перевірки алокатора
+        }                            // Кінець перевірки самоприсвоєння
+        return *this;                // Повертаємо посилання на поточний об'єкт
+    }                                // Кінець оператора переміщення
+    
+    // Обмін вмістом двох списків за O(1) (з вбудованими вузлами - поелементно)
+    void swap(LinkedList& other) noexcept(InlineNodes == 0) { // Функція обміну
+        if (local().inUse() || other.local().inUse()) {          // Якщо вузли прив'язані до об'єктів
+            LinkedList temp(std::move(other));               // обмінюємо через тимчасовий список
+            other = std::move(*this);                        // Вміст цього - в other
+            *this = std::move(temp);                         // Вміст other - у цей
+            return;                                          // Обмін завершено
+        }                                                    // Кінець перевірки
+        std::swap(head, other.head);                         // Обмінюємо голови
+        std::swap(tail, other.tail);                         // Обмінюємо хвости
+        std::swap(size, other.size);                         // Обмінюємо розміри
+        if (NodeTraits::propagate_on_container_swap::value) { // Якщо алокатори обмінюються
+            std::swap(alloc, other.alloc);                   // обмінюємо й алокатори
+        }                                                    // Кінець перевірки
+    }                                                        // Кінець функції swap
+    
     // Створення нового елемента на початку списку
-    void pushFront(const T& value) {     // Функція додавання елемента на початок
-        Node* newNode = new Node(value); // Створюємо новий вузол з переданим значенням
+    void pushFront(const T& value) {     // Функція додавання копії елемента на початок
+        emplaceFront(value);             // Копіюємо значення у новий вузол
+    }                                    // Кінець функції pushFront
+    
+    // Створення нового елемента на початку списку з переміщенням значення
+    void pushFront(T&& value) {          // Функція додавання елемента на початок
+        emplaceFront(std::move(value));  // Переміщуємо значення у новий вузол
+    }                                    // Кінець функції pushFront
+    
+    // Створення елемента на початку списку безпосередньо у вузлі з аргументів конструктора T
+    template <typename... Args>
+    T& emplaceFront(Args&&... args) {    // Функція створення елемента на початку
+        Node* newNode = createNode(std::forward<Args>(args)...); // Створюємо новий вузол (з пулу)
         
         if (head == nullptr) {           // Якщо список порожній
             head = tail = newNode;       // новий вузол стає і головою, і хвостом
         } else {                         // Якщо список не порожній
             newNode->next = head;        // новий вузол вказує на колишню голову
+            head->prev = newNode;        // колишня голова вказує назад на новий вузол
             head = newNode;              // новий вузол стає новою головою
         }                                // Кінець перевірки порожності списку
         size++;                          // Збільшуємо лічильник елементів на 1
-    }                                    // Кінець функції pushFront
+        return newNode->data;            // Повертаємо посилання на створений елемент
+    }                                    // Кінець функції emplaceFront
     
     // Вилучення першого елемента списку
     void popFront() {                                      // Функція видалення першого елемента
@@ -72,42 +882,53 @@ public:                     // Публічна секція класу (дос
         
         if (head == nullptr) {           // Якщо список став порожнім після видалення
             tail = nullptr;              // обнуляємо покажчик на хвіст
+        } else {                         // Інакше
+            head->prev = nullptr;        // у нової голови немає попереднього вузла
         }                                // Кінець перевірки на порожність після видалення
         
-        delete temp;                     // Звільняємо пам'ять видаленого вузла
+        destroyNode(temp);               // Повертаємо вузол у пул
         size--;                          // Зменшуємо лічильник елементів на 1
     }                                    // Кінець функції popFront
     
     // Створення нового елемента в кінці списку
-    void pushBack(const T& value) {      // Функція додавання елемента в кінець
-        Node* newNode = new Node(value); // Створюємо новий вузол з переданим значенням
+    void pushBack(const T& value) {      // Функція додавання копії елемента в кінець
+        emplaceBack(value);              // Копіюємо значення у новий вузол
+    }                                    // Кінець функції pushBack
+    
+    // Створення нового елемента в кінці списку з переміщенням значення
+    void pushBack(T&& value) {           // Функція додавання елемента в кінець
+        emplaceBack(std::move(value));   // Переміщуємо значення у новий вузол
+    }                                    // Кінець функції pushBack
+    
+    // Створення елемента в кінці списку безпосередньо у вузлі з аргументів конструктора T
+    template <typename... Args>
+    T& emplaceBack(Args&&... args) {     // Функція створення елемента в кінці
+        Node* newNode = createNode(std::forward<Args>(args)...); // Створюємо новий вузол (з пулу)
         
         if (tail == nullptr) {           // Якщо список порожній
             head = tail = newNode;       // новий вузол стає і головою, і хвостом
         } else {                         // Якщо список не порожній
             tail->next = newNode;        // колишній хвіст вказує на новий вузол
+            newNode->prev = tail;        // новий вузол вказує назад на колишній хвіст
             tail = newNode;              // новий вузол стає новим хвостом
         }                                // Кінець перевірки порожності списку
         size++;                          // Збільшуємо лічильник елементів на 1
-    }                                    // Кінець функції pushBack
+        return newNode->data;            // Повертаємо посилання на створений елемент
+    }                                    // Кінець функції emplaceBack
     
-    // Вилучення останнього елемента списку
+    // Вилучення останнього елемента списку за O(1) (передостанній вузол відомий через prev)
     void popBack() {                                       // Функція видалення останнього елемента
         if (head == nullptr) {                             // Якщо список порожній
             throw std::runtime_error("Список порожній");   // викидаємо виняток
         }                                                  // Кінець перевірки порожності
         
         if (head == tail) {              // Якщо в списку тільки один елемент
-            delete head;                 // видаляємо цей елемент
+            destroyNode(head);           // видаляємо цей елемент
             head = tail = nullptr;       // обнуляємо обидва покажчики
         } else {                         // Якщо в списку більше одного елемента
-            // Знаходимо передостанній елемент
-            Node* current = head;        // Починаємо з голови списку
-            while (current->next != tail) { // Поки не дійшли до передостаннього елемента
-                current = current->next; // переходимо до наступного елемента
-            }                            // Кінець пошуку передостаннього елемента
+            Node* current = tail->prev;  // Передостанній елемент - без проходу від голови
             
-            delete tail;                 // Видаляємо останній елемент
+            destroyNode(tail);           // Видаляємо останній елемент
             tail = current;              // Передостанній елемент стає новим хвостом
             tail->next = nullptr;        // Обнуляємо покажчик на наступний елемент
         }                                // Кінець перевірки кількості елементів
@@ -158,32 +979,1011 @@ public:                     // Публічна секція класу (дос
     
     // Очищення списку
     void clear() {                       // Функція очищення всього списку
+        if constexpr (HasBulkRelease<NodeAlloc>::value) { // Якщо алокатор вміє звільняти все разом
+            if (alloc.canRelease()) {    // і його пул належить лише цьому списку
+                if (!std::is_trivially_destructible<T>::value) { // Якщо елементам потрібен деструктор
+                    for (Node* current = head; current != nullptr; ) { // Проходимо по всіх вузлах
+                        Node* next = current->next;                   // Зберігаємо наступний вузол
+                        NodeTraits::destroy(alloc, current);          // Викликаємо деструктор вузла
+                        current = next;                               // Переходимо до наступного
+                    }                                                 // Кінець циклу деструкторів
+                }                        // Кінець перевірки деструктора
+                alloc.release();         // Звільняємо всі шматки пулу разом, без обходу вузлів
+                local().reset();           // Вбудовані вузли теж вільні
+                head = tail = nullptr;   // Обнуляємо покажчики
+                size = 0;                // Скидаємо лічильник елементів
+                return;                  // Список очищено
+            }                            // Кінець перевірки пулу
+        }                                // Кінець перевірки алокатора
         while (head != nullptr) {        // Поки список не порожній
             Node* temp = head;           // Зберігаємо покажчик на поточний перший елемент
             head = head->next;           // Переміщуємо голову на наступний елемент
-            delete temp;                 // Видаляємо колишній перший елемент
+            destroyNode(temp);           // Видаляємо колишній перший елемент
         }                                // Кінець циклу видалення
         tail = nullptr;                  // Обнуляємо покажчик на хвіст
         size = 0;                        // Скидаємо лічильник елементів
     }                                    // Кінець функції clear
     
-    // Виведення списку
-    void print() const {                     // Функція виведення елементів списку (const - не змінює об'єкт)
-        Node* current = head;                // Покажчик для проходження по списку, починаємо з голови
-        std::cout << "[";                    // Виводимо відкриваючу квадратну дужку
-        while (current != nullptr) {         // Поки не дійшли до кінця списку
-            std::cout << current->data;      // Виводимо дані поточного елемента
+    // Ітератори на початок та кінець списку
+    iterator begin() { return iterator(head); }                      // Початок (зміна елементів)
+    iterator end() { return iterator(nullptr); }                     // Кінець (зміна елементів)
+    const_iterator begin() const { return const_iterator(head); }    // Початок (лише читання)
+    const_iterator end() const { return const_iterator(nullptr); }   // Кінець (лише читання)
+    const_iterator cbegin() const { return const_iterator(head); }   // Початок (лише читання)
+    const_iterator cend() const { return const_iterator(nullptr); }  // Кінець (лише читання)
+    
+    // Вставка елемента після позиції position; повертає ітератор на новий елемент
+    template <typename... Args>
+    iterator emplaceAfter(const_iterator position, Args&&... args) { // Функція вставки на місці
+        if (position.node == nullptr) {                             // Якщо позиція - кінець списку
+            throw std::runtime_error("Неможливо вставити після кінця списку"); // викидаємо виняток
+        }                                                           // Кінець перевірки
+        Node* node = createNode(std::forward<Args>(args)...);       // Створюємо новий вузол
+        linkAfter(position.node, node);                             // Вставляємо його після позиції
+        return iterator(node);                                      // Повертаємо ітератор на новий елемент
+    }                                                               // Кінець функції emplaceAfter
+    
+    iterator insertAfter(const_iterator position, const T& value) { // Вставка копії після позиції
+        return emplaceAfter(position, value);                       // Копіюємо значення
+    }                                                               // Кінець функції insertAfter
+    
+    iterator insertAfter(const_iterator position, T&& value) {      // Вставка з переміщенням після позиції
+        return emplaceAfter(position, std::move(value));            // Переміщуємо значення
+    }                                                               // Кінець функції insertAfter
+    
+    // Видалення елемента після позиції position; повертає ітератор на елемент за видаленим
+    iterator eraseAfter(const_iterator position) {                  // Функція видалення після позиції
+        if (position.node == nullptr || position.node->next == nullptr) { // Якщо після позиції нічого немає
+            throw std::runtime_error("Немає елемента після позиції"); // викидаємо виняток
+        }                                                           // Кінець перевірки
+        Node* victim = position.node->next;                         // Вузол, що видаляється
+        position.node->next = victim->next;                         // Обходимо його у прямому напрямку
+        if (victim->next != nullptr) {                              // Якщо він не був хвостом
+            victim->next->prev = position.node;                     // обходимо його у зворотному напрямку
+        } else {                                                    // Інакше
+            tail = position.node;                                   // хвостом стає позиція
+        }                                                           // Кінець перевірки
+        destroyNode(victim);                                        // Повертаємо вузол у пул
+        size--;                                                     // Зменшуємо лічильник елементів
+        return iterator(position.node->next);                       // Повертаємо ітератор на наступний
+    }                                                               // Кінець функції eraseAfter
+    
+    // Перенесення всіх елементів other в кінець цього списку. Вузли переносяться без
+    // копіювання, якщо пам'ять other можна прийняти; інакше елементи переміщуються по одному
+    void splice(LinkedList& other) {                                // Функція перенесення елементів
+        if (&other == this || other.head == nullptr) {              // Нічого переносити
+            return;                                                 // завершуємо
+        }                                                           // Кінець перевірки
+        if (adoptNodesFrom(other)) {                                // Якщо вузли можна перенести
+            if (head == nullptr) {                                  // Якщо цей список порожній
+                head = other.head;                                  // голова - голова other
+            } else {                                                // Інакше
+                tail->next = other.head;                            // зшиваємо хвіст з головою other
+                other.head->prev = tail;                            // і зворотний зв'язок
+            }                                                       // Кінець перевірки
+            tail = other.tail;                                      // Хвіст - хвіст other
+            size += other.size;                                     // Додаємо розмір
+            other.head = other.tail = nullptr;                      // other стає порожнім
+            other.size = 0;                                         // Обнуляємо розмір other
+        } else {                                                    // Інакше
+            moveElementsFrom(other);                                // переміщуємо елементи по одному
+        }                                                           // Кінець перевірки
+    }                                                               // Кінець функції splice
+    
+    // Перенесення всіх елементів other після позиції position
+    void spliceAfter(const_iterator position, LinkedList& other) {  // Функція перенесення після позиції
+        if (position.node == nullptr) {                             // Якщо позиція - кінець списку
+            throw std::runtime_error("Неможливо вставити після кінця списку"); // викидаємо виняток
+        }                                                           // Кінець перевірки
+        Node* after = position.node->next;                          // Вузол, що йшов за позицією
+        Node* oldTail = tail;                                       // Колишній хвіст
+        position.node->next = nullptr;                              // Тимчасово відрізаємо решту списку
+        tail = position.node;                                       // позиція стає хвостом
+        size_t rest = 0;                                            // Кількість відрізаних вузлів
+        for (Node* current = after; current != nullptr; current = current->next) { // Рахуємо їх
+            rest++;                                                 // збільшуємо лічильник
+        }                                                           // Кінець циклу
+        size -= rest;                                               // Тимчасово зменшуємо розмір
+        splice(other);                                              // Дописуємо other у кінець
+        if (after != nullptr) {                                     // Якщо було що відрізано
+            tail->next = after;                                     // пришиваємо решту назад
+            after->prev = tail;                                     // і зворотний зв'язок
+            tail = oldTail;                                         // Хвіст - колишній хвіст
+            size += rest;                                           // Повертаємо розмір
+        }                                                           // Кінець перевірки
+    }                                                               // Кінець функції spliceAfter
+    
+    // Розворот списку на місці за O(n) - лише обмін покажчиків
+    void reverse() {                                                // Функція розвороту
+        for (Node* current = head; current != nullptr; current = current->prev) { // Йдемо по списку
+            std::swap(current->next, current->prev);                // Обмінюємо напрямки зв'язків
+        }                                                           // Кінець циклу (prev - колишній next)
+        std::swap(head, tail);                                      // Голова та хвіст міняються місцями
+    }                                                               // Кінець функції reverse
+    
+    // Злиття з відсортованим списком other (обидва відсортовані); other стає порожнім
+    template <typename Compare = std::less<>>
+    void merge(LinkedList& other, Compare less = Compare()) {       // Функція злиття
+        if (&other == this || other.head == nullptr) {              // Нічого зливати
+            return;                                                 // завершуємо
+        }                                                           // Кінець перевірки
+        Node* boundary = tail;                                      // Останній вузол першої частини
+        splice(other);                                              // Дописуємо other у кінець
+        if (boundary == nullptr) {                                  // Якщо цей список був порожній
+            return;                                                 // результат уже відсортований
+        }                                                           // Кінець перевірки
+        Node* second = boundary->next;                              // Початок другої частини
+        boundary->next = nullptr;                                   // Розрізаємо частини
+        head = mergeRuns(head, second, less);                       // Зливаємо покажчиками next
+        relinkPrev();                                               // Відновлюємо prev та хвіст
+    }                                                               // Кінець функції merge
+    
+    // Стабільне сортування злиттям на місці за O(n log n) без виділення пам'яті
+    template <typename Compare = std::less<>>
+    void sort(Compare less = Compare()) {                           // Функція сортування
+        if (size < 2) {                                             // Список з 0 або 1 елемента
+            return;                                                 // уже відсортований
+        }                                                           // Кінець перевірки
+        Node* cursor = head;                                        // Курсор по вузлах
+        head = sortRun(cursor, size, less);                         // Сортуємо ланцюжок next
+        relinkPrev();                                               // Відновлюємо prev та хвіст
+    }                                                               // Кінець функції sort
+    
+    // Додавання елементів діапазону [first, last) у кінець списку за один прохід. Якщо довжину
+    // діапазону відомо заздалегідь, пам'ять під усі вузли готується одним шматком пулу
+    template <typename InputIt>
+    void append(InputIt first, InputIt last) {                      // Функція масового додавання
+        using Category = typename std::iterator_traits<InputIt>::iterator_category; // Категорія ітератора
+        if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) { // Якщо можна порахувати довжину
+            reserveNodes(size_t(std::distance(first, last)));       // резервуємо пам'ять під усі вузли
+        }                                                           // Кінець перевірки
+        for (; first != last; ++first) {                            // Для кожного елемента діапазону
+            Node* node = createNode(*first);                        // Створюємо вузол
+            node->prev = tail;                                      // Він іде за поточним хвостом
+            if (tail != nullptr) {                                  // Якщо список не порожній
+                tail->next = node;                                  // хвіст вказує на новий вузол
+            } else {                                                // Інакше
+                head = node;                                        // новий вузол стає головою
+            }                                                       // Кінець перевірки
+            tail = node;                                            // Новий вузол - новий хвіст
+            size++;                                                 // Збільшуємо лічильник елементів
+        }                                                           // Кінець циклу
+    }                                                               // Кінець функції append
+    
+    // Двійковий запис списку: кількість елементів (uint64_t) і байти елементів підряд
+    // (порядок байтів - як на цій машині). Лише для тривіально копійованих T
+    void serialize(std::ostream& out) const {                      // Функція двійкового запису
+        static_assert(std::is_trivially_copyable<T>::value, "serialize потребує тривіально копійованого T");
+        std::uint64_t count = size;                                 // Кількість елементів
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count)); // Записуємо заголовок
+        std::vector<char> buffer(std::min(size, IO_CHUNK) * sizeof(T)); // Буфер на одну порцію
+        size_t filled = 0;                                          // Байтів у буфері
+        for (Node* current = head; current != nullptr; current = current->next) { // Проходимо по списку
+            std::memcpy(buffer.data() + filled, &current->data, sizeof(T)); // Копіюємо елемент у буфер
+            filled += sizeof(T);                                    // Зсуваємо позицію
+            if (filled == buffer.size()) {                          // Якщо буфер заповнено
+                out.write(buffer.data(), std::streamsize(filled));  // записуємо порцію
+                filled = 0;                                         // і починаємо нову
+            }                                                       // Кінець перевірки
+        }                                                           // Кінець циклу
+        out.write(buffer.data(), std::streamsize(filled));          // Записуємо залишок
+        if (!out) {                                                 // Якщо запис не вдався
+            throw std::runtime_error("Не вдалося записати список"); // викидаємо виняток
+        }                                                           // Кінець перевірки
+    }                                                               // Кінець функції serialize
+    
+    // Відновлення списку, записаного serialize: вузли створюються за один прохід з пулу.
+    // Кількості із заголовка не довіряємо: пам'ять готується порціями, вже після читання їхніх даних
+    static LinkedList deserialize(std::istream& in, const Alloc& allocator = Alloc()) { // Функція двійкового читання
+        static_assert(std::is_trivially_copyable<T>::value && std::is_default_constructible<T>::value,
+                      "deserialize потребує тривіально копійованого T з конструктором за замовчуванням");
+        std::uint64_t count = 0;                                    // Кількість елементів
+        if (!in.read(reinterpret_cast<char*>(&count), sizeof(count))) { // Читаємо заголовок
+            throw std::runtime_error("Не вдалося прочитати розмір списку"); // Заголовка немає
+        }                                                           // Кінець перевірки
+        LinkedList result(allocator);                               // Новий список
+        std::vector<char> buffer(size_t(std::min<std::uint64_t>(count, IO_CHUNK)) * sizeof(T)); // Буфер на одну порцію
+        std::uint64_t remaining = count;                            // Скільки елементів лишилось прочитати
+        while (remaining > 0) {                                     // Поки є непрочитані елементи
+            size_t portion = size_t(std::min<std::uint64_t>(remaining, IO_CHUNK)); // Розмір порції
+            if (!in.read(buffer.data(), std::streamsize(portion * sizeof(T)))) { // Читаємо порцію
+                throw std::runtime_error("Дані списку обірвано");   // Файл коротший, ніж заявлено
+            }                                                       // Кінець перевірки
+            result.reserveNodes(portion);                           // Пам'ять під вузли порції одним шматком
+            for (size_t i = 0; i < portion; i++) {                  // Для кожного елемента порції
+                T& value = result.emplaceBack();                    // Створюємо вузол у кінці
+                std::memcpy(&value, buffer.data() + i * sizeof(T), sizeof(T)); // Заповнюємо його байтами
+            }                                                       // Кінець циклу
+            remaining -= portion;                                   // Порцію прочитано
+        }                                                           // Кінець циклу
+        return result;                                              // Повертаємо список
+    }                                                               // Кінець функції deserialize
+    
+    // Отримання копії алокатора списку
+    Alloc get_allocator() const {        // Функція повернення алокатора
+        return Alloc(alloc);             // Перетворюємо алокатор вузлів на алокатор елементів
+    }                                    // Кінець функції get_allocator
+    
+    // Виведення списку у потік out. Елементи форматуються в буфер і потрапляють у out
+    // порціями по IO_CHUNK елементів; потік не скидається (std::endl не використовується)
+    void print(std::ostream& out = std::cout) const { // Функція виведення елементів списку (const - не змінює об'єкт)
+        std::ostringstream buffer;           // Буфер форматування
+        buffer.copyfmt(out);                 // Те саме форматування, що й у out
+        buffer.width(0);                     // Ширина поля out не стосується дужки
+        buffer << "[";                       // Виводимо відкриваючу квадратну дужку
+        size_t pending = 0;                  // Елементів у буфері
+        for (Node* current = head; current != nullptr; current = current->next) { // Проходимо по списку
+            buffer << current->data;         // Виводимо дані поточного елемента
             if (current->next != nullptr) {  // Якщо це не останній елемент
-                std::cout << ", ";           // виводимо кому з пробілом
+                buffer << ", ";              // виводимо кому з пробілом
             }                                // Кінець перевірки на останній елемент
-            current = current->next;         // Переходимо до наступного елемента
+            if (++pending == IO_CHUNK) {     // Якщо в буфері набралась порція
+                const std::string& text = buffer.str(); // Вміст буфера
+                out.write(text.data(), std::streamsize(text.size())); // записуємо її в out
+                buffer.str(std::string());   // і очищуємо буфер
+                pending = 0;                 // Починаємо нову порцію
+            }                                // Кінець перевірки порції
         }                                    // Кінець циклу виведення
-        std::cout << "]" << std::endl;       // Виводимо закриваючу дужку та перехід на новий рядок
+        buffer << "]\n";                     // Виводимо закриваючу дужку та перехід на новий рядок
+        const std::string& text = buffer.str(); // Решта буфера
+        out.write(text.data(), std::streamsize(text.size())); // Записуємо її в out
     }                                        // Кінець функції print
 };                                           // Кінець класу LinkedList
 
+// Багатопотокова черга без блокувань (алгоритм Michael-Scott) для схеми виробник/споживач.
+// Пам'ять видалених вузлів звільняється безпечно через hazard pointers: вузол використовується
+// знову лише тоді, коли жоден потік не позначив його як такий, що зараз читається. Кожен потік
+// має власний запис hazard (thread_local) і власний запас вільних вузлів, тому звичайна операція
+// не захоплює запис і не звертається до глобального алокатора
+template <typename T>      // Оголошуємо параметризований шаблон з типом T
+class ConcurrentQueue {    // Оголошуємо клас конкурентної черги
+private:                   // Приватна секція класу
+    // Вузол черги; перший вузол - фіктивний (його значення вже забрано або ще не було)
+    struct Node {                                      // Оголошуємо структуру вузла
+        std::atomic<Node*> next;                       // Наступний вузол
+        alignas(T) unsigned char storage[sizeof(T)];   // Пам'ять під значення (створюється вручну)
+        
+        Node() : next(nullptr) {}                      // Конструктор вузла без значення
+        
+        T* value() {                                   // Доступ до значення
+            return std::launder(reinterpret_cast<T*>(storage)); // Покажчик на значення у сховищі
+        }                                              // Кінець функції value
+    };                                                 // Кінець структури Node
+    
+    static constexpr std::size_t SCAN_THRESHOLD = 256; // Скільки вузлів накопичити перед очищенням (щонайменше)
+    static constexpr std::size_t SPARE_BATCH = 256;    // Скільки вільних вузлів передається між потоками за раз
+    
+    // Запис hazard pointers: належить одному потоку, поки той працює з чергами
+    struct alignas(64) HazardRecord {                  // Вирівнювання - щоб записи не ділили рядок кешу
+        std::atomic<bool> active{false};               // Чи зайнятий запис потоком
+        std::atomic<Node*> hazard[2] = { {nullptr}, {nullptr} }; // Вузли, які зараз читає власник
+        HazardRecord* nextRecord = nullptr;            // Наступний запис у спільному списку
+        std::vector<Node*> retired;                    // Вилучені вузли, що чекають звільнення
+        std::vector<Node*> spare;                      // Вільні вузли для наступних додавань
+        std::vector<Node*> hazards;                    // Робочий масив scan (щоб не виділяти пам'ять щоразу)
+    };                                                 // Кінець структури HazardRecord
+    
+    // Спільні для всіх черг з елементами T записи hazard і склад вільних вузлів: вузол, вилучений
+    // з однієї черги, може чекати в записі потоку, який уже працює з іншою
+    struct Domain {                                    // Оголошуємо спільний домен
+        std::atomic<HazardRecord*> records{nullptr};   // Список записів (лише зростає)
+        std::atomic<std::size_t> recordCount{0};       // Кількість записів
+        std::mutex depotMutex;                         // М'ютекс складу
+        std::vector<std::vector<Node*>> depot;         // Пачки вільних вузлів (від споживачів до виробників)
+        std::atomic<std::size_t> depotBatches{0};      // Кількість пачок на складі (перевірка без м'ютекса)
+        
+        // Деструктор - наприкінці програми, коли потоки вже завершились
+        ~Domain() {                                                 // Початок деструктора
+            HazardRecord* record = records.load();                  // Перший запис
+            while (record != nullptr) {                             // Для кожного запису
+                HazardRecord* next = record->nextRecord;            // Наступний запис
+                for (Node* node : record->retired) delete node;     // Вилучені вузли (без значень)
+                for (Node* node : record->spare) delete node;       // Вільні вузли
+                delete record;                                      // Сам запис
+                record = next;                                      // Переходимо до наступного
+            }                                                       // Кінець циклу
+            for (std::vector<Node*>& batch : depot) {               // Пачки на складі
+                for (Node* node : batch) delete node;               // звільняємо
+            }                                                       // Кінець циклу
+        }                                                           // Кінець деструктора
+    };                                                              // Кінець структури Domain
+    
+    static Domain& domain() {                                       // Доступ до спільного домену
+        static Domain instance;                                     // Створюється при першому зверненні
+        return instance;                                            // Повертаємо домен
+    }                                                               // Кінець функції domain
+    
+    alignas(64) std::atomic<Node*> head;               // Голова (фіктивний вузол), звідси забирають
+    alignas(64) std::atomic<Node*> tail;               // Хвіст, сюди додають
+    alignas(64) std::atomic<std::size_t> count;        // Кількість елементів (для обмеження ємності)
+    std::size_t capacity;                              // Найбільша кількість елементів
+    
+    // Захоплення вільного запису або створення нового (кількість потоків не обмежена)
+    static HazardRecord* acquireRecord() {                                 // Функція захоплення запису
+        Domain& shared = domain();                                         // Спільний домен
+        for (HazardRecord* record = shared.records.load(std::memory_order_acquire); record != nullptr;
+             record = record->nextRecord) {                                // Перебираємо записи
+            if (!record->active.load(std::memory_order_relaxed) &&         // Якщо запис вільний
+                !record->active.exchange(true, std::memory_order_acquire)) { // і ми встигли його зайняти
+                return record;                                             // повертаємо його (разом з вузлами)
+            }                                                              // Кінець перевірки
+        }                                                                  // Кінець перебору
+        HazardRecord* record = new HazardRecord();                         // Вільних немає - новий запис
+        record->active.store(true, std::memory_order_relaxed);             // Одразу зайнятий
+        record->nextRecord = shared.records.load(std::memory_order_relaxed); // Додаємо на початок списку
+        while (!shared.records.compare_exchange_weak(record->nextRecord, record,
+                                                     std::memory_order_release, std::memory_order_relaxed)) {}
+        shared.recordCount.fetch_add(1, std::memory_order_relaxed);        // Рахуємо запис
+        return record;                                                     // Повертаємо його
+    }                                                                      // Кінець функції acquireRecord
+    
+    // Запис потоку: захоплюється при першій операції і звільняється, коли потік завершується;
+    // вилучені та вільні вузли лишаються в записі для наступного власника
+    struct RecordHolder {                                                  // Оголошуємо власника запису
+        HazardRecord* record;                                              // Захоплений запис
+        RecordHolder() : record(acquireRecord()) {}                        // Захоплюємо
+        ~RecordHolder() {                                                  // Звільняємо
+            record->hazard[0].store(nullptr, std::memory_order_release);   // Знімаємо позначки
+            record->hazard[1].store(nullptr, std::memory_order_release);   // з обох вузлів
+            record->active.store(false, std::memory_order_release);        // Запис знову вільний
+        }                                                                  // Кінець деструктора
+    };                                                                     // Кінець структури RecordHolder
+    
+    // Запис hazard поточного потоку
+    static HazardRecord& localRecord() {                                   // Функція запису потоку
+        static thread_local RecordHolder holder;                           // Один запис на потік
+        return *holder.record;                                             // Повертаємо його
+    }                                                                      // Кінець функції localRecord
+    
+    // Зняття позначок після операції (RAII)
+    struct HazardGuard {                                                   // Оголошуємо охоронця позначок
+        HazardRecord& record;                                              // Запис потоку
+        explicit HazardGuard(HazardRecord& owner) : record(owner) {}       // Запам'ятовуємо запис
+        ~HazardGuard() {                                                   // Знімаємо позначки
+            record.hazard[0].store(nullptr, std::memory_order_release);    // з обох
+            record.hazard[1].store(nullptr, std::memory_order_release);    // вузлів
+        }                                                                  // Кінець деструктора
+    };                                                                     // Кінець структури HazardGuard
+    
+    // Читання покажчика з позначкою hazard: позначка ставиться і перевіряється, що покажчик не змінився
+    static Node* protect(HazardRecord& record, int slot, const std::atomic<Node*>& source) { // Функція захисту
+        Node* pointer = source.load(std::memory_order_acquire);            // Читаємо покажчик
+        while (true) {                                                     // Поки не переконаємось
+            record.hazard[slot].store(pointer);                            // Позначаємо вузол (seq_cst: до повторного читання)
+            Node* again = source.load();                                   // Читаємо ще раз
+            if (again == pointer) {                                        // Якщо не змінився
+                return pointer;                                            // вузол захищено
+            }                                                              // Кінець перевірки
+            pointer = again;                                               // Інакше пробуємо з новим
+        }                                                                  // Кінець циклу
+    }                                                                      // Кінець функції protect
+    
+    // Вузол для нового елемента: із запасу потоку, зі складу або (якщо вузлів немає) з алокатора
+    static Node* allocateNode(HazardRecord& record) {                      // Функція отримання вузла
+        if (record.spare.empty()) {                                        // Якщо власний запас вичерпано
+            Domain& shared = domain();                                     // Спільний домен
+            if (shared.depotBatches.load(std::memory_order_relaxed) != 0) { // Якщо на складі щось є
+                std::lock_guard<std::mutex> lock(shared.depotMutex);       // Блокуємо склад
+                if (!shared.depot.empty()) {                               // Якщо пачку ще не забрали
+                    record.spare.swap(shared.depot.back());                // беремо її цілою
+                    shared.depot.pop_back();                               // і вилучаємо зі складу
+                    shared.depotBatches.fetch_sub(1, std::memory_order_relaxed); // Пачок поменшало
+                }                                                          // Кінець перевірки
+            }                                                              // Кінець перевірки складу
+        }                                                                  // Кінець перевірки запасу
+        if (record.spare.empty()) {                                        // Якщо вузлів так і немає
+            return new Node();                                             // виділяємо новий
+        }                                                                  // Кінець перевірки
+        Node* node = record.spare.back();                                  // Беремо вузол із запасу
+        record.spare.pop_back();                                           // Вилучаємо його
+        node->next.store(nullptr, std::memory_order_relaxed);              // Вузол ще ні з чим не зв'язаний
+        return node;                                                       // Повертаємо вузол
+    }                                                                      // Кінець функції allocateNode
+    
+    // Вузол, який більше ніхто не читає, - у запас потоку; надлишок іде на склад
+    static void recycle(HazardRecord& record, Node* node) {                // Функція повторного використання
+        record.spare.push_back(node);                                      // Додаємо вузол у запас
+        if (record.spare.size() >= 2 * SPARE_BATCH) {                      // Якщо запас завеликий (споживач)
+            std::vector<Node*> batch(record.spare.end() - SPARE_BATCH, record.spare.end()); // Пачка для інших
+            record.spare.resize(record.spare.size() - SPARE_BATCH);        // Вилучаємо її із запасу
+            Domain& shared = domain();                                     // Спільний домен
+            std::lock_guard<std::mutex> lock(shared.depotMutex);           // Блокуємо склад
+            shared.depot.push_back(std::move(batch));                      // Кладемо пачку
+            shared.depotBatches.fetch_add(1, std::memory_order_relaxed);   // Пачок побільшало
+        }                                                                  // Кінець перевірки
+    }                                                                      // Кінець функції recycle
+    
+    // Вилучений вузол чекає, поки його ніхто не читатиме
+    static void retire(HazardRecord& record, Node* node) {                 // Функція відкладеного звільнення
+        record.retired.push_back(node);                                    // Додаємо вузол у список
+        std::size_t threshold = std::max(SCAN_THRESHOLD,                   // Поріг - удвічі більше за кількість
+            4 * domain().recordCount.load(std::memory_order_relaxed));     // позначок усіх записів
+        if (record.retired.size() >= threshold) {                          // Якщо накопичилось багато
+            scan(record);                                                  // звільняємо непозначені
+        }                                                                  // Кінець перевірки
+    }                                                                      // Кінець функції retire
+    
+    // Повторне використання вилучених вузлів, яких немає серед позначок hazard усіх записів
+    static void scan(HazardRecord& record) {                               // Функція очищення
+        std::vector<Node*>& hazards = record.hazards;                      // Усі позначені вузли
+        hazards.clear();                                                   // Минулий вміст не потрібен
+        for (HazardRecord* other = domain().records.load(std::memory_order_acquire); other != nullptr;
+             other = other->nextRecord) {                                  // Перебираємо записи
+            for (const std::atomic<Node*>& hazard : other->hazard) {       // і їхні позначки
+                if (Node* pointer = hazard.load()) {                       // Якщо позначка є
+                    hazards.push_back(pointer);                            // запам'ятовуємо
+                }                                                          // Кінець перевірки
+            }                                                              // Кінець циклу позначок
+        }                                                                  // Кінець циклу записів
+        std::sort(hazards.begin(), hazards.end());                         // Сортуємо для швидкого пошуку
+        std::size_t kept = 0;                                              // Вузли, які ще не можна звільнити
+        for (Node* node : record.retired) {                                // Для кожного вилученого
+            if (std::binary_search(hazards.begin(), hazards.end(), node)) { // Якщо його хтось читає
+                record.retired[kept++] = node;                             // залишаємо на потім
+            } else {                                                       // Інакше
+                recycle(record, node);                                     // вузол знову вільний
+            }                                                              // Кінець перевірки
+        }                                                                  // Кінець циклу
+        record.retired.resize(kept);                                       // Залишок чекає наступного разу
+    }                                                                      // Кінець функції scan
+    
+public:                    // Публічна секція класу
+    // Конструктор; maxSize - ємність черги (за замовчуванням необмежена)
+    explicit ConcurrentQueue(std::size_t maxSize = SIZE_MAX)
+        : head(nullptr), tail(nullptr), count(0), capacity(maxSize) {
+        Node* dummy = new Node();          // Фіктивний вузол
+        head.store(dummy);                 // Голова і хвіст
+        tail.store(dummy);                 // вказують на нього
+    }                                      // Кінець конструктора
+    
+    // Деструктор - звільняє всі вузли (інші потоки вже не працюють з чергою; вилучені
+    // вузли лишаються в записах потоків і використовуються іншими чергами)
+    ~ConcurrentQueue() {                                            // Початок деструктора
+        Node* node = head.load();                                   // Фіктивний вузол
+        Node* next = node->next.load();                             // Перший вузол зі значенням
+        delete node;                                                // Звільняємо фіктивний
+        while (next != nullptr) {                                   // Для кожного вузла зі значенням
+            node = next;                                            // Поточний вузол
+            next = node->next.load();                               // Наступний вузол
+            node->value()->~T();                                    // Руйнуємо значення
+            delete node;                                            // Звільняємо вузол
+        }                                                           // Кінець циклу
+    }                                                               // Кінець деструктора
+    
+    ConcurrentQueue(const ConcurrentQueue&) = delete;               // Черга не копіюється
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;    // Черга не присвоюється
+    
+    // Спроба додати елемент у кінець; false - черга заповнена
+    template <typename U>
+    bool tryPush(U&& value) {                                       // Функція додавання
+        if (count.fetch_add(1, std::memory_order_relaxed) >= capacity) { // Якщо місця немає
+            count.fetch_sub(1, std::memory_order_relaxed);          // повертаємо лічильник
+            return false;                                           // і повідомляємо про невдачу
+        }                                                           // Кінець перевірки
+        HazardRecord& record = localRecord();                       // Запис потоку
+        Node* node = allocateNode(record);                          // Новий вузол
+        try {                                                       // Якщо конструктор T викине виняток
+            ::new (static_cast<void*>(node->storage)) T(std::forward<U>(value)); // Значення у вузлі
+        } catch (...) {                                             // то
+            record.spare.push_back(node);                           // повертаємо вузол у запас
+            count.fetch_sub(1, std::memory_order_relaxed);          // повертаємо лічильник
+            throw;                                                  // і передаємо виняток далі
+        }                                                           // Кінець обробки винятку
+        HazardGuard guard(record);                                  // Позначки знімаються після операції
+        while (true) {                                              // Поки не додамо
+            Node* last = protect(record, 0, tail);                  // Захищений хвіст
+            Node* next = last->next.load(std::memory_order_acquire); // Наступний за хвостом
+            if (last != tail.load(std::memory_order_acquire)) {     // Якщо хвіст змінився
+                continue;                                           // пробуємо знову
+            }                                                       // Кінець перевірки
+            if (next != nullptr) {                                  // Якщо хвіст відстає
+                tail.compare_exchange_weak(last, next);             // допомагаємо його зсунути
+                continue;                                           // і пробуємо знову
+            }                                                       // Кінець перевірки
+            if (last->next.compare_exchange_weak(next, node)) {     // Пришиваємо новий вузол
+                tail.compare_exchange_strong(last, node);           // Зсуваємо хвіст (або хтось допоможе)
+                return true;                                        // Елемент додано
+            }                                                       // Кінець перевірки
+        }                                                           // Кінець циклу
+    }                                                               // Кінець функції tryPush
+    
+    // Спроба забрати елемент з початку; false - черга порожня
+    bool tryPop(T& result) {                                        // Функція вилучення
+        HazardRecord& record = localRecord();                       // Запис потоку
+        HazardGuard guard(record);                                  // Позначки знімаються після операції
+        while (true) {                                              // Поки не заберемо або не побачимо порожнечу
+            Node* first = protect(record, 0, head);                 // Захищена голова (фіктивний вузол)
+            Node* last = tail.load(std::memory_order_acquire);      // Хвіст
+            Node* next = protect(record, 1, first->next);           // Захищений вузол зі значенням
+            if (first != head.load(std::memory_order_acquire)) {    // Якщо голова змінилась
+                continue;                                           // пробуємо знову
+            }                                                       // Кінець перевірки
+            if (next == nullptr) {                                  // Якщо за головою нічого немає
+                return false;                                       // черга порожня
+            }                                                       // Кінець перевірки
+            if (first == last) {                                    // Якщо хвіст відстає
+                tail.compare_exchange_weak(last, next);             // допомагаємо його зсунути
+                continue;                                           // і пробуємо знову
+            }                                                       // Кінець перевірки
+            if (head.compare_exchange_weak(first, next)) {          // Зсуваємо голову: next - новий фіктивний
+                result = std::move(*next->value());                 // Забираємо значення (next захищений)
+                next->value()->~T();                                // Руйнуємо значення у вузлі
+                count.fetch_sub(1, std::memory_order_relaxed);      // Зменшуємо лічильник
+                record.hazard[0].store(nullptr, std::memory_order_release); // Старий фіктивний більше не читаємо
+                retire(record, first);                              // і віддаємо його на звільнення
+                return true;                                        // Елемент забрано
+            }                                                       // Кінець перевірки
+        }                                                           // Кінець циклу
+    }                                                               // Кінець функції tryPop
+    
+    // Приблизна кількість елементів (точна, лише коли інші потоки не працюють)
+    std::size_t approxSize() const {                                // Функція розміру
+        return count.load(std::memory_order_relaxed);               // Повертаємо лічильник
+    }                                                               // Кінець функції approxSize
+};                                                                  // Кінець класу ConcurrentQueue
+
+// LinkedList під зовнішнім м'ютексом - для порівняння з ConcurrentQueue
+template <typename T>
+class MutexQueue {                                                  // Оголошуємо клас черги з м'ютексом
+private:                                                            // Приватна секція класу
+    std::mutex m;                                                   // М'ютекс
+    LinkedList<T> list;                                             // Список елементів
+    
+public:                                                             // Публічна секція класу
+    bool tryPush(const T& value) {                                  // Функція додавання
+        std::lock_guard<std::mutex> lock(m);                        // Блокуємо список
+        list.pushBack(value);                                       // Додаємо в кінець
+        return true;                                                // Завжди успішно
+    }                                                               // Кінець функції tryPush
+    
+    bool tryPop(T& result) {                                        // Функція вилучення
+        std::lock_guard<std::mutex> lock(m);                        // Блокуємо список
+        if (list.isEmpty()) {                                       // Якщо список порожній
+            return false;                                           // повідомляємо про невдачу
+        }                                                           // Кінець перевірки
+        result = std::move(list.front());                           // Забираємо перший елемент
+        list.popFront();                                            // Видаляємо його
+        return true;                                                // Елемент забрано
+    }                                                               // Кінець функції tryPop
+};                                                                  // Кінець класу MutexQueue
+
+// Вимірювання часу виконання функції в наносекундах
+template <typename F>
+double measureNs(F f) {                                            // Функція вимірювання часу
+    auto start = std::chrono::steady_clock::now();                 // Час початку
+    f();                                                           // Виконуємо вимірювану дію
+    auto stop = std::chrono::steady_clock::now();                  // Час завершення
+    return std::chrono::duration<double, std::nano>(stop - start).count(); // Повертаємо різницю в нс
+}                                                                  // Кінець функції measureNs
+
+// Спорожнення списку з кінця: LinkedList (O(1) на popBack) проти однозв'язного списку,
+// де для кожного видалення треба знайти передостанній вузол від голови (O(n))
+void benchPopBack() {                                              // Функція порівняння popBack
+    std::cout << "=== popBack: спорожнення списку з кінця ===" << std::endl; // Заголовок
+    std::cout << std::left << std::setw(12) << "n"                 // Заголовок таблиці
+              << "LinkedList, нс/оп     Однозв'язний (пошук передостаннього), нс/оп" << std::endl;
+    const size_t sizes[] = { 1000, 10000, 100000, 1000000 };       // Розміри списків
+    for (size_t n : sizes) {                                       // Для кожного розміру
+        LinkedList<int> list;                                      // Двозв'язний список
+        for (size_t i = 0; i < n; i++) {                           // Заповнюємо список
+            list.pushBack(int(i));                                 // додаючи елементи в кінець
+        }                                                          // Кінець заповнення
+        double listNs = measureNs([&]() {                          // Вимірюємо спорожнення з кінця
+            while (!list.isEmpty()) {                              // Поки список не порожній
+                list.popBack();                                    // видаляємо останній елемент
+            }                                                      // Кінець циклу
+        }) / n;                                                    // Час на одну операцію
+        std::cout << std::left << std::setw(12) << n << std::setw(22) << std::fixed
+                  << std::setprecision(1) << listNs;               // Виводимо результат LinkedList
+        if (n <= 30000) {                                          // Квадратичний варіант - лише для малих n
+            std::forward_list<int> single(n, 0);                   // Однозв'язний список без покажчика на хвіст
+            double singleNs = measureNs([&]() {                    // Вимірюємо спорожнення з кінця
+                while (!single.empty()) {                          // Поки список не порожній
+                    if (std::next(single.begin()) == single.end()) { // Якщо залишився один елемент
+                        single.pop_front();                        // видаляємо його
+                        continue;                                  // і завершуємо
+                    }                                              // Кінець перевірки
+                    auto before = single.begin();                  // Шукаємо передостанній вузол від голови
+                    while (std::next(before, 2) != single.end()) { // Поки за наступним є ще вузли
+                        ++before;                                  // рухаємось далі
+                    }                                              // Кінець пошуку
+                    single.erase_after(before);                    // Видаляємо останній вузол
+                }                                                  // Кінець циклу
+            }) / n;                                                // Час на одну операцію
+            std::cout << singleNs;                                 // Виводимо результат
+        } else {                                                   // Для великих n
+            std::cout << "(пропущено: O(n^2))";                    // квадратичний варіант занадто довгий
+        }                                                          // Кінець перевірки розміру
+        std::cout << std::endl;                                    // Переходимо на новий рядок
+    }                                                              // Кінець циклу за розмірами
+}                                                                  // Кінець функції benchPopBack
+
+// Стрес-тест ConcurrentQueue: кожен елемент має бути отриманий рівно один раз, а елементи
+// одного виробника - у порядку додавання (FIFO). Для обмеженої черги виробники повторюють
+// спробу, поки місце не звільниться
+bool stressConcurrentQueue(int producers, int consumers, std::uint64_t perProducer,
+                           std::size_t capacity = SIZE_MAX) {     // Функція стрес-тесту
+    ConcurrentQueue<std::uint64_t> queue(capacity);                // Черга, що перевіряється
+    std::atomic<std::uint64_t> rejected{0};                        // Скільки разів черга була заповнена
+    std::atomic<std::uint64_t> received{0};                        // Кількість отриманих елементів
+    std::atomic<bool> ok{true};                                    // Чи не виявлено помилок
+    std::vector<std::vector<std::uint64_t>> seen(consumers);       // Скільки разів отримано кожен елемент
+    std::vector<std::thread> threads;                              // Потоки тесту
+    const std::uint64_t total = producers * perProducer;           // Загальна кількість елементів
+    for (int p = 0; p < producers; p++) {                          // Виробники
+        threads.emplace_back([&, p]() {                            // Потік виробника
+            for (std::uint64_t i = 0; i < perProducer; i++) {      // Додаємо свої елементи
+                while (!queue.tryPush((std::uint64_t(p) << 32) | i)) { // старші біти - номер виробника
+                    rejected.fetch_add(1, std::memory_order_relaxed); // Черга заповнена
+                    std::this_thread::yield();                     // поступаємось споживачам
+                }                                                  // Кінець повторних спроб
+            }                                                      // Кінець циклу
+        });                                                        // Кінець потоку виробника
+    }                                                              // Кінець циклу виробників
+    for (int c = 0; c < consumers; c++) {                          // Споживачі
+        threads.emplace_back([&, c]() {                            // Потік споживача
+            std::vector<std::int64_t> last(producers, -1);         // Останній номер від кожного виробника
+            seen[c].assign(total, 0);                              // Лічильники отримань
+            std::uint64_t value = 0;                               // Отримане значення
+            while (received.load() < total) {                      // Поки не отримано все
+                if (!queue.tryPop(value)) {                        // Якщо черга порожня
+                    std::this_thread::yield();                     // поступаємось
+                    continue;                                      // і пробуємо знову
+                }                                                  // Кінець перевірки
+                std::uint64_t producer = value >> 32;              // Номер виробника
+                std::int64_t index = std::int64_t(value & 0xFFFFFFFFu); // Номер елемента виробника
+                if (index <= last[producer]) {                     // Порушено порядок FIFO
+                    ok = false;                                    // помилка
+                }                                                  // Кінець перевірки
+                last[producer] = index;                            // Запам'ятовуємо номер
+                seen[c][producer * perProducer + index]++;         // Рахуємо отримання
+                received++;                                        // Ще один елемент отримано
+            }                                                      // Кінець циклу
+        });                                                        // Кінець потоку споживача
+    }                                                              // Кінець циклу споживачів
+    for (std::thread& t : threads) {                               // Очікуємо всі потоки
+        t.join();                                                  // завершення потоку
+    }                                                              // Кінець циклу
+    for (std::uint64_t i = 0; i < total; i++) {                    // Кожен елемент
+        std::uint64_t times = 0;                                   // Скільки разів отримано
+        for (int c = 0; c < consumers; c++) {                      // усіма споживачами
+            times += seen[c][i];                                   // додаємо
+        }                                                          // Кінець циклу
+        if (times != 1) {                                          // Має бути рівно один раз
+            ok = false;                                            // інакше помилка
+        }                                                          // Кінець перевірки
+    }                                                              // Кінець циклу
+    if (capacity == SIZE_MAX && rejected != 0) {                   // Необмежена черга не відмовляє
+        ok = false;                                                // інакше помилка
+    }                                                              // Кінець перевірки
+    std::uint64_t leftover = 0;                                    // Залишок у черзі
+    return ok && !queue.tryPop(leftover) && queue.approxSize() == 0; // Черга має бути порожня
+}                                                                  // Кінець функції stressConcurrentQueue
+
+// Запуск стрес-тестів з різною кількістю потоків
+bool runStressTests() {                                            // Функція запуску стрес-тестів
+    std::cout << "=== Стрес-тест ConcurrentQueue ===" << std::endl; // Заголовок
+    bool allOk = true;                                             // Чи пройдено всі тести
+    const int configs[][2] = { { 1, 1 }, { 4, 4 }, { 8, 2 }, { 2, 8 }, { 16, 16 } }; // Виробники/споживачі
+    for (const auto& config : configs) {                           // Для кожної конфігурації
+        bool ok = stressConcurrentQueue(config[0], config[1], 20000); // Запускаємо тест
+        std::cout << config[0] << " виробників / " << config[1] << " споживачів: "
+                  << (ok ? "OK" : "ПОМИЛКА") << std::endl;         // Виводимо результат
+        allOk = allOk && ok;                                       // Враховуємо результат
+    }                                                              // Кінець циклу
+    const int boundedConfigs[][2] = { { 4, 4 }, { 8, 2 }, { 2, 8 } }; // Обмежена черга під навантаженням
+    for (const auto& config : boundedConfigs) {                    // Для кожної конфігурації
+        bool ok = stressConcurrentQueue(config[0], config[1], 20000, 4); // Ємність 4 - черга часто заповнена
+        std::cout << "Ємність 4, " << config[0] << " виробників / " << config[1] << " споживачів: "
+                  << (ok ? "OK" : "ПОМИЛКА") << std::endl;         // Виводимо результат
+        allOk = allOk && ok;                                       // Враховуємо результат
+    }                                                              // Кінець циклу
+    ConcurrentQueue<int> bounded(4);                               // Черга ємністю 4
+    int pushed = 0;                                                // Кількість успішних додавань
+    for (int i = 0; i < 10; i++) {                                 // Пробуємо додати 10 елементів
+        pushed += bounded.tryPush(i) ? 1 : 0;                      // рахуємо успішні
+    }                                                              // Кінець циклу
+    bool boundedOk = pushed == 4;                                  // Має поміститись лише 4
+    std::cout << "Обмежена черга (ємність 4, 10 спроб): додано " << pushed << " - "
+              << (boundedOk ? "OK" : "ПОМИЛКА") << std::endl;      // Виводимо результат
+    return allOk && boundedOk;                                     // Повертаємо загальний результат
+}                                                                  // Кінець функції runStressTests
+
+// Пропускна здатність черги (млн операцій push+pop за секунду) для заданої кількості потоків:
+// половина потоків - виробники, половина - споживачі (один потік робить і те, і те)
+template <typename Queue>
+double queueThroughput(int threadCount, std::uint64_t items) {     // Функція вимірювання пропускної здатності
+    Queue queue;                                                   // Черга, що вимірюється
+    std::atomic<std::uint64_t> received{0};                        // Кількість отриманих елементів
+    double ns = measureNs([&]() {                                  // Вимірюємо час
+        if (threadCount == 1) {                                    // Один потік
+            std::uint64_t value = 0;                               // Отримане значення
+            for (std::uint64_t i = 0; i < items; i++) {            // додає та забирає по черзі
+                queue.tryPush(i);                                  // Додаємо
+                queue.tryPop(value);                               // Забираємо
+            }                                                      // Кінець циклу
+            return;                                                // Завершуємо вимірювання
+        }                                                          // Кінець перевірки
+        int producers = threadCount / 2;                           // Кількість виробників
+        int consumers = threadCount - producers;                   // Кількість споживачів
+        std::vector<std::thread> threads;                          // Потоки
+        for (int p = 0; p < producers; p++) {                      // Виробники
+            threads.emplace_back([&, p]() {                        // Потік виробника
+                std::uint64_t from = items * p / producers;        // Початок своєї частини
+                std::uint64_t to = items * (p + 1) / producers;    // Кінець своєї частини
+                for (std::uint64_t i = from; i < to; i++) {        // Додаємо свою частину
+                    queue.tryPush(i);                              // елемент
+                }                                                  // Кінець циклу
+            });                                                    // Кінець потоку виробника
+        }                                                          // Кінець циклу виробників
+        for (int c = 0; c < consumers; c++) {                      // Споживачі
+            threads.emplace_back([&]() {                           // Потік споживача
+                std::uint64_t value = 0;                           // Отримане значення
+                while (received.load(std::memory_order_relaxed) < items) { // Поки не отримано все
+                    if (queue.tryPop(value)) {                     // Якщо елемент є
+                        received.fetch_add(1, std::memory_order_relaxed); // рахуємо його
+                    } else {                                       // Інакше
+                        std::this_thread::yield();                 // поступаємось
+                    }                                              // Кінець перевірки
+                }                                                  // Кінець циклу
+            });                                                    // Кінець потоку споживача
+        }                                                          // Кінець циклу споживачів
+        for (std::thread& t : threads) {                           // Очікуємо всі потоки
+            t.join();                                              // завершення потоку
+        }                                                          // Кінець циклу
+    });                                                            // Кінець вимірювання
+    return items / (ns * 1e-9) / 1e6;                              // Млн елементів за секунду
+}                                                                  // Кінець функції queueThroughput
+
+// Порівняння ConcurrentQueue з LinkedList під м'ютексом при 1-64 потоках
+void benchConcurrentQueue() {                                      // Функція порівняння черг
+    std::cout << "\n=== Черга між потоками: млн елементів/с ===" << std::endl; // Заголовок
+    std::cout << "Потоків   ConcurrentQueue        LinkedList + mutex" << std::endl; // Заголовок таблиці
+    const std::uint64_t items = 200000;                            // Кількість елементів у кожному вимірюванні
+    for (int threads = 1; threads <= 64; threads *= 2) {           // 1, 2, 4, ..., 64 потоки
+        double lockFree = queueThroughput<ConcurrentQueue<std::uint64_t>>(threads, items); // Без блокувань
+        double locked = queueThroughput<MutexQueue<std::uint64_t>>(threads, items);        // З м'ютексом
+        std::cout << std::left << std::setw(10) << threads << std::fixed << std::setprecision(2)
+                  << std::setw(23) << lockFree << locked << std::endl; // Виводимо результат
+    }                                                              // Кінець циклу
+}                                                                  // Кінець функції benchConcurrentQueue
+
+// Значення для вимірювань: ціле число або рядок, довший за вбудований буфер std::string
+template <typename T>
+T makeValue(std::size_t i);                                        // Оголошення генератора значень
+
+template <>
+int makeValue<int>(std::size_t i) {                                // Ціле значення
+    return int(i);                                                 // Номер елемента
+}                                                                  // Кінець функції makeValue<int>
+
+template <>
+std::string makeValue<std::string>(std::size_t i) {                // Рядкове значення
+    std::string digits = std::to_string(i);                        // Номер елемента
+    return "item-" + std::string(12 - std::min<std::size_t>(12, digits.size()), '0') + digits; // 17 символів
+}                                                                  // Кінець функції makeValue<std::string>
+
+// Однакові операції для різних контейнерів: загальний варіант - для std::list та std::deque
+template <typename C>
+struct ContainerOps {                                              // Операції контейнера
+    static constexpr bool HAS_POP_BACK = true;                     // Чи можна видаляти з кінця
+    template <typename Gen>
+    static void fillBack(C& c, std::size_t n, Gen gen) {           // Заповнення з кінця
+        for (std::size_t i = 0; i < n; i++) c.push_back(gen(i));   // Додаємо в кінець
+    }                                                              // Кінець методу fillBack
+    template <typename Gen>
+    static void fillFront(C& c, std::size_t n, Gen gen) {          // Заповнення з початку
+        for (std::size_t i = 0; i < n; i++) c.push_front(gen(i));  // Додаємо на початок
+    }                                                              // Кінець методу fillFront
+    static void drainFront(C& c) {                                 // Спорожнення з початку
+        while (!c.empty()) c.pop_front();                          // Видаляємо перший елемент
+    }                                                              // Кінець методу drainFront
+    static void drainBack(C& c) {                                  // Спорожнення з кінця
+        while (!c.empty()) c.pop_back();                           // Видаляємо останній елемент
+    }                                                              // Кінець методу drainBack
+};                                                                 // Кінець структури ContainerOps
+
+template <typename T, typename A, std::size_t N>
+struct ContainerOps<LinkedList<T, A, N>> {                            // Операції нашого списку
+    static constexpr bool HAS_POP_BACK = true;                     // popBack працює за O(1)
+    template <typename Gen>
+    static void fillBack(LinkedList<T, A, N>& c, std::size_t n, Gen gen) { // Заповнення з кінця
+        for (std::size_t i = 0; i < n; i++) c.pushBack(gen(i));    // Додаємо в кінець
+    }                                                              // Кінець методу fillBack
+    template <typename Gen>
+    static void fillFront(LinkedList<T, A, N>& c, std::size_t n, Gen gen) { // Заповнення з початку
+        for (std::size_t i = 0; i < n; i++) c.pushFront(gen(i));   // Додаємо на початок
+    }                                                              // Кінець методу fillFront
+    static void drainFront(LinkedList<T, A, N>& c) {                  // Спорожнення з початку
+        while (!c.isEmpty()) c.popFront();                         // Видаляємо перший елемент
+    }                                                              // Кінець методу drainFront
+    static void drainBack(LinkedList<T, A, N>& c) {                   // Спорожнення з кінця
+        while (!c.isEmpty()) c.popBack();                          // Видаляємо останній елемент
+    }                                                              // Кінець методу drainBack
+};                                                                 // Кінець структури ContainerOps<LinkedList>
+
+template <typename T>
+struct ContainerOps<std::forward_list<T>> {                        // Операції однозв'язного списку STL
+    static constexpr bool HAS_POP_BACK = false;                    // Видалення з кінця немає
+    template <typename Gen>
+    static void fillBack(std::forward_list<T>& c, std::size_t n, Gen gen) { // Заповнення з кінця
+        auto tail = c.before_begin();                              // Покажчик на хвіст тримаємо самі
+        for (std::size_t i = 0; i < n; i++) tail = c.insert_after(tail, gen(i)); // Додаємо після хвоста
+    }                                                              // Кінець методу fillBack
+    template <typename Gen>
+    static void fillFront(std::forward_list<T>& c, std::size_t n, Gen gen) { // Заповнення з початку
+        for (std::size_t i = 0; i < n; i++) c.push_front(gen(i));  // Додаємо на початок
+    }                                                              // Кінець методу fillFront
+    static void drainFront(std::forward_list<T>& c) {              // Спорожнення з початку
+        while (!c.empty()) c.pop_front();                          // Видаляємо перший елемент
+    }                                                              // Кінець методу drainFront
+    static void drainBack(std::forward_list<T>&) {                 // Спорожнення з кінця не підтримується
+    }                                                              // Кінець методу drainBack
+};                                                                 // Кінець структури ContainerOps<forward_list>
+
+// Результат вимірювання одного контейнера: нс/оп для кожної операції, виділення та пік пам'яті
+struct ContainerBenchResult {                                      // Структура результату
+    double pushBackNs, pushFrontNs, traverseNs, copyNs;            // нс/оп заповнення, обходу та копіювання
+    double popFrontNs, popBackNs, clearNs;                         // нс/оп видалення та очищення
+    double allocationsPerElement;                                  // Виділень пам'яті на елемент при заповненні
+    double peakMb;                                                 // Пік зайнятої пам'яті, МБ
+};                                                                 // Кінець структури ContainerBenchResult
+
+// Вимірювання всіх операцій одного контейнера на n елементах
+template <typename C>
+ContainerBenchResult benchContainer(std::size_t n) {               // Функція вимірювання контейнера
+    using T = typename C::value_type;                              // Тип елементів
+    using Ops = ContainerOps<C>;                                   // Операції контейнера
+    auto gen = [](std::size_t i) { return makeValue<T>(i); };      // Генератор значень
+    ContainerBenchResult r{};                                      // Результат
+    const std::size_t baseline = g_bytesInUse.load();              // Зайнята пам'ять до вимірювання
+    g_peakBytes = baseline;                                        // Починаємо відлік піку заново
+    {                                                              // Область життя контейнерів
+        C c;                                                       // Вимірюваний контейнер
+        std::size_t allocationsBefore = g_allocations;             // Виділень до заповнення
+        r.pushBackNs = measureNs([&]() { Ops::fillBack(c, n, gen); }) / n; // Заповнення з кінця
+        r.allocationsPerElement = double(g_allocations - allocationsBefore) / n; // Виділень на елемент
+        volatile std::size_t sink = 0;                             // Не даємо компілятору прибрати обхід
+        r.traverseNs = measureNs([&]() {                           // Обхід усіх елементів
+            std::size_t sum = 0;                                   // Сума для перевірки
+            for (const T& value : c) {                             // Для кожного елемента
+                if constexpr (std::is_same<T, std::string>::value) sum += value.size(); // Довжина рядка
+                else sum += std::size_t(value);                    // Значення числа
+            }                                                      // Кінець обходу
+            sink = sum;                                            // Зберігаємо результат
+        }) / n;                                                    // Час на елемент
+        {                                                          // Область життя копії
+            C* copy = nullptr;                                     // Копія контейнера
+            r.copyNs = measureNs([&]() { copy = new C(c); }) / n;  // Копіювання
+            r.clearNs = measureNs([&]() { copy->clear(); }) / n;   // Очищення копії
+            delete copy;                                           // Звільняємо порожню копію
+        }                                                          // Кінець області копії
+        r.popFrontNs = measureNs([&]() { Ops::drainFront(c); }) / n; // Спорожнення з початку
+        r.pushFrontNs = measureNs([&]() { Ops::fillFront(c, n, gen); }) / n; // Заповнення з початку
+        r.popBackNs = std::numeric_limits<double>::quiet_NaN();    // Не підтримується за замовчуванням
+        if constexpr (Ops::HAS_POP_BACK) {                         // Якщо контейнер видаляє з кінця
+            r.popBackNs = measureNs([&]() { Ops::drainBack(c); }) / n; // Спорожнення з кінця
+        }                                                          // Кінець перевірки
+    }                                                              // Кінець області контейнерів
+    r.peakMb = double(g_peakBytes - baseline) / (1024.0 * 1024.0); // Пік пам'яті понад базовий рівень
+    return r;                                                      // Повертаємо результат
+}                                                                  // Кінець функції benchContainer
+
+// Вивід одного рядка таблиці порівняння контейнерів
+void printContainerRow(const char* name, const ContainerBenchResult& r) { // Функція виводу рядка
+    auto cell = [](double value) {                                 // Одна клітинка таблиці
+        if (std::isnan(value)) {                                   // Операція не підтримується
+            std::cout << std::setw(10) << "-";                     // Прочерк
+        } else {                                                   // Інакше
+            std::cout << std::setw(10) << value;                   // Значення
+        }                                                          // Кінець перевірки
+    };                                                             // Кінець лямбди cell
+    std::cout << std::left << std::setw(20) << name << std::fixed << std::setprecision(1); // Назва контейнера
+    for (double value : { r.pushBackNs, r.pushFrontNs, r.traverseNs, r.copyNs,
+                          r.popFrontNs, r.popBackNs, r.clearNs }) { // Усі операції
+        cell(value);                                               // Виводимо клітинку
+    }                                                              // Кінець циклу
+    std::cout << std::setprecision(3) << std::setw(10) << r.allocationsPerElement
+              << std::setprecision(1) << r.peakMb << std::endl;    // Виділення та пік пам'яті
+}                                                                  // Кінець функції printContainerRow
+
+// Порівняння LinkedList зі списками та деком STL на n елементах типу T
+template <typename T>
+void benchContainers(const char* typeName, std::size_t n) {        // Функція порівняння контейнерів
+    std::cout << "\n--- " << typeName << ", n = " << n << " (нс/оп) ---" << std::endl; // Заголовок
+    std::cout << "Контейнер           pushBack  pushFront обхід     копія     popFront  popBack   clear     "
+                 "виділ/ел  пік, МБ" << std::endl;                  // Заголовок таблиці
+    printContainerRow("LinkedList", benchContainer<LinkedList<T>>(n));            // Наш список
+    printContainerRow("std::list", benchContainer<std::list<T>>(n));              // Двозв'язний список STL
+    printContainerRow("std::forward_list", benchContainer<std::forward_list<T>>(n)); // Однозв'язний список STL
+    printContainerRow("std::deque", benchContainer<std::deque<T>>(n));            // Дек STL
+}                                                                  // Кінець функції benchContainers
+
+// Порівняння контейнерів для int та std::string на 10^3 - maxSize елементах
+void benchContainerSuite(std::size_t maxSize) {                    // Функція набору вимірювань
+    std::cout << "\n=== LinkedList проти контейнерів STL ===" << std::endl; // Заголовок
+    for (std::size_t n = 1000; n <= maxSize; n *= 10) {            // 10^3, 10^4, ... елементів
+        benchContainers<int>("int", n);                            // Цілі числа
+        benchContainers<std::string>("std::string", n);            // Рядки
+    }                                                              // Кінець циклу
+}                                                                  // Кінець функції benchContainerSuite
+
+// Двійкове збереження та завантаження великого списку
+void benchSerialization() {                                        // Функція вимірювання serialize/deserialize
+    std::cout << "\n=== serialize / deserialize ===" << std::endl; // Заголовок
+    const size_t n = 1000000;                                      // Кількість елементів
+    std::vector<int> source(n);                                    // Вихідні дані
+    std::iota(source.begin(), source.end(), 0);                    // 0, 1, 2, ...
+    LinkedList<int> list(source.begin(), source.end());            // Масове завантаження з діапазону
+    std::stringstream binary;                                      // Двійковий потік у пам'яті
+    double saveNs = measureNs([&]() { list.serialize(binary); }) / n; // Запис
+    LinkedList<int> restored;                                      // Відновлений список
+    std::size_t allocationsBefore = g_allocations;                 // Виділень до читання
+    double loadNs = measureNs([&]() { restored = LinkedList<int>::deserialize(binary); }) / n; // Читання
+    std::size_t allocations = g_allocations - allocationsBefore;   // Виділень під час читання
+    bool same = std::equal(restored.begin(), restored.end(), source.begin()) && restored.getSize() == n; // Перевірка
+    std::cout << std::fixed << std::setprecision(1) << n << " елементів: запис " << saveNs
+              << " нс/ел, читання " << loadNs << " нс/ел, виділень пам'яті при читанні - " << allocations
+              << ", шматків пулу - " << restored.get_allocator().slabCount()
+              << (same ? " (дані збігаються)" : " (ПОМИЛКА: дані відрізняються)") << std::endl; // Результат
+    std::ostringstream text;                                       // Текстовий вивід у пам'ять
+    double printNs = measureNs([&]() { list.print(text); }) / n;   // Буферизований print
+    std::cout << "print у потік: " << printNs << " нс/ел" << std::endl; // Результат
+}                                                                  // Кінець функції benchSerialization
+
+// Створення та знищення багатьох коротких списків: з малим буфером і без нього
+template <std::size_t InlineNodes>
+void benchShortList(std::size_t elements) {                        // Функція вимірювання коротких списків
+    const std::size_t lists = 1000000;                             // Кількість списків
+    std::size_t allocationsBefore = g_allocations;                 // Виділень до вимірювання
+    volatile std::size_t sink = 0;                                 // Не даємо компілятору прибрати роботу
+    double ns = measureNs([&]() {                                  // Вимірюємо час
+        for (std::size_t i = 0; i < lists; i++) {                  // Для кожного списку
+            LinkedList<int, PoolAllocator<int>, InlineNodes> list; // Новий список
+            for (std::size_t j = 0; j < elements; j++) {           // Заповнюємо його
+                list.pushBack(int(j));                             // елементами
+            }                                                      // Кінець заповнення
+            sink = sink + list.back();                             // Використовуємо результат
+        }                                                          // Кінець циклу (список знищується)
+    }) / lists;                                                    // Час на один список
+    std::cout << std::left << std::setw(6) << InlineNodes << std::setw(10) << elements
+              << std::setw(12) << sizeof(LinkedList<int, PoolAllocator<int>, InlineNodes>) // Розмір об'єкта
+              << std::setw(14) << std::fixed << std::setprecision(1) << ns
+              << double(g_allocations - allocationsBefore) / lists << std::endl; // Виводимо результат
+}                                                                  // Кінець функції benchShortList
+
+// Порівняння коротких списків з малим буфером і без нього
+void benchSmallBuffer() {                                          // Функція порівняння малого буфера
+    std::cout << "\n=== Малий буфер: створення та знищення 10^6 коротких списків ===" << std::endl; // Заголовок
+    std::cout << "N     елементів байт        нс/список     виділень/список" << std::endl; // Заголовок таблиці
+    const std::size_t lengths[] = { 1, 4, 8, 16 };                 // Довжини списків
+    for (std::size_t elements : lengths) {                         // Для кожної довжини
+        benchShortList<0>(elements);                               // Без малого буфера
+        benchShortList<2>(elements);                               // Два вузли - об'єкт у двох рядках кешу
+        benchShortList<8>(elements);                               // З малим буфером на 8 вузлів
+    }                                                              // Кінець циклу
+}                                                                  // Кінець функції benchSmallBuffer
+
+// Запуск усіх вимірювань продуктивності
+void runBenchmarks(std::size_t maxSize) {                          // Функція запуску вимірювань
+    benchPopBack();                                                // Спорожнення списку з кінця
+    benchConcurrentQueue();                                        // Черга між потоками
+    benchSerialization();                                          // Збереження та завантаження
+    benchSmallBuffer();                                            // Малий буфер коротких списків
+    benchContainerSuite(maxSize);                                  // Порівняння з контейнерами STL
+}                                                                  // Кінець функції runBenchmarks
+
 // Демонстрація використання
-int main() {                                                        // Головна функція програми
+int main(int argc, char* argv[]) {                                  // Головна функція програми
+    if (argc > 1 && std::string(argv[1]) == "--bench") {           // Режим вимірювання продуктивності
+        std::size_t maxSize = argc > 2 ? std::stoul(argv[2]) : 10000000; // Найбільший розмір (--bench N)
+        runBenchmarks(maxSize);                                    // Запускаємо вимірювання
+        return 0;                                                  // Завершуємо програму
+    }                                                              // Кінець перевірки режиму
+    if (argc > 1 && std::string(argv[1]) == "--stress") {          // Режим стрес-тесту черги
+        return runStressTests() ? 0 : 1;                           // Код завершення - результат тесту
+    }                                                              // Кінець перевірки режиму
+    
     std::cout << "=== Тестування LinkedList<int> ===" << std::endl; // Виводимо заголовок тестування
     
     LinkedList<int> intList;                                        // Створюємо список цілих чисел
@@ -237,6 +2037,106 @@ int main() {                                                        // Голо
     std::cout << "Копія: ";                                        // Повідомляємо про вивід копії
     copyList.print();                                              // Виводимо скопійований список
     
+    // Ітератори та алгоритми
+    std::cout << "\n=== Тестування ітераторів ===" << std::endl; // Заголовок для тестування ітераторів
+    LinkedList<int> numbers;                                       // Список чисел
+    for (int value : { 5, 1, 4, 2, 3 }) {                          // Додаємо числа
+        numbers.pushBack(value);                                   // в кінець списку
+    }                                                              // Кінець циклу додавання
+    std::cout << "Сума (std::accumulate): " << std::accumulate(numbers.begin(), numbers.end(), 0) << std::endl; // Сума без копіювання
+    std::cout << "Число 4 знайдено (std::find): " << (std::find(numbers.begin(), numbers.end(), 4) != numbers.end() ? "Так" : "Ні") << std::endl;
+    for (int& value : numbers) {                                   // Range-for зі зміною елементів
+        value *= 10;                                               // множимо кожен елемент на 10
+    }                                                              // Кінець циклу
+    numbers.insertAfter(numbers.begin(), 15);                      // Вставляємо 15 після першого елемента
+    numbers.eraseAfter(std::next(numbers.begin(), 2));             // Видаляємо четвертий елемент
+    std::cout << "Після *10, insertAfter та eraseAfter: ";         // Повідомляємо про вивід
+    numbers.print();                                               // Виводимо список
+    numbers.sort();                                                // Сортуємо злиттям
+    std::cout << "sort: ";                                         // Повідомляємо про вивід
+    numbers.print();                                               // Виводимо список
+    numbers.reverse();                                             // Розвертаємо список
+    std::cout << "reverse: ";                                      // Повідомляємо про вивід
+    numbers.print();                                               // Виводимо список
+    numbers.reverse();                                             // Повертаємо зростаючий порядок
+    LinkedList<int> odd;                                           // Другий відсортований список
+    for (int value : { 5, 25, 45 }) {                              // Додаємо непарні числа
+        odd.pushBack(value);                                       // в кінець списку
+    }                                                              // Кінець циклу додавання
+    numbers.merge(odd);                                            // Зливаємо відсортовані списки
+    std::cout << "merge з [5, 25, 45]: ";                          // Повідомляємо про вивід
+    numbers.print();                                               // Виводимо список
+    std::cout << "Розмір другого списку після merge: " << odd.getSize() << std::endl; // other порожній
+    
+    // Переміщення
+    std::cout << "\n=== Тестування переміщення ===" << std::endl; // Заголовок для тестування переміщення
+    LinkedList<std::string> longStrings;                           // Список довгих рядків
+    for (int i = 0; i < 1000; i++) {                               // Додаємо 1000 рядків
+        longStrings.emplaceBack(64, char('a' + i % 26));           // рядок створюється прямо у вузлі
+    }                                                              // Кінець циклу додавання
+    std::size_t before = g_allocations;                            // Кількість виділень до переміщення
+    LinkedList<std::string> movedStrings = std::move(longStrings); // Переміщуємо список
+    std::cout << "Переміщення 1000 рядків: виділень пам'яті - " << g_allocations - before << std::endl; // 0 виділень
+    std::string word(64, 'x');                                     // Довгий рядок
+    before = g_allocations;                                        // Кількість виділень до додавання
+    movedStrings.pushBack(std::move(word));                        // Переміщуємо рядок у вузол (вузол - з пулу)
+    std::cout << "pushBack(std::move(рядок)): виділень пам'яті - " << g_allocations - before << std::endl; // Буфер рядка не копіюється
+    LinkedList<std::string> copyStrings = movedStrings;            // Копія з тією ж довжиною рядків
+    before = g_allocations;                                        // Кількість виділень до присвоєння
+    copyStrings = movedStrings;                                    // Присвоєння у наявні вузли та буфери рядків
+    std::cout << "Присвоєння копії у наявні вузли: виділень пам'яті - " << g_allocations - before << std::endl; // 0 виділень
+    
+    // Пул вузлів
+    std::cout << "\n=== Тестування пулу вузлів ===" << std::endl;   // Заголовок для тестування пулу
+    LinkedList<int> poolList;                                      // Список з пулом вузлів за замовчуванням
+    for (int i = 0; i < 1000; i++) {                               // Додаємо 1000 елементів
+        poolList.pushBack(i);                                      // кожен вузол береться з пулу
+    }                                                              // Кінець циклу додавання
+    std::cout << "1000 вузлів у " << poolList.get_allocator().slabCount() << " шматках пам'яті" << std::endl; // Кількість шматків
+    for (int i = 0; i < 500; i++) {                                // Видаляємо та знову додаємо 500 елементів
+        poolList.popFront();                                       // вузол повертається у список вільних
+        poolList.pushBack(i);                                      // і одразу використовується знову
+    }                                                              // Кінець циклу
+    std::cout << "Після 500 pop/push шматків: " << poolList.get_allocator().slabCount() << std::endl; // Нових шматків немає
+    poolList.clear();                                              // Звільнення всіх шматків разом
+    std::cout << "Після clear шматків: " << poolList.get_allocator().slabCount() << std::endl; // Лишається власний шматок пулу
+    
+    LinkedList<int, PoolAllocator<int>, 2> tinyList;               // Малий буфер на 2 вузли
+    std::cout << "Розмір об'єкта: без буфера - " << sizeof(LinkedList<int>) << " байт, N = 2 - "
+              << sizeof(tinyList) << " байт (два рядки кешу)" << std::endl; // Ціна вбудованих вузлів
+    LinkedList<int, PoolAllocator<int>, 8> smallList;              // Список з малим буфером на 8 вузлів
+    before = g_allocations;                                        // Кількість виділень до заповнення
+    for (int i = 1; i <= 8; i++) {                                 // Додаємо 8 елементів
+        smallList.pushBack(i);                                     // вузли беруться з вбудованого буфера
+    }                                                              // Кінець циклу
+    std::cout << "8 елементів у малому буфері: виділень пам'яті - " << g_allocations - before
+              << ", розмір об'єкта - " << sizeof(smallList) << " байт (кожне місце - цілий вузол з next/prev)" << std::endl; // 0 виділень
+    smallList.pushBack(9);                                         // Дев'ятий вузол уже з пулу
+    std::cout << "Дев'ятий елемент: шматків пулу - " << smallList.get_allocator().slabCount() << std::endl; // Пул створено
+    
+    LinkedList<int, std::allocator<int>> heapList;                 // Список зі стандартним алокатором
+    heapList.pushBack(1);                                          // Кожен вузол - окремий виклик new
+    heapList.pushBack(2);                                          // Додаємо ще один елемент
+    std::cout << "Список зі std::allocator: ";                     // Повідомляємо про вивід
+    heapList.print();                                              // Виводимо список
+    
+    // Збереження та завантаження
+    std::cout << "\n=== Збереження та завантаження ===" << std::endl; // Заголовок для тестування вводу/виводу
+    std::vector<int> source = { 5, 10, 15, 20 };                   // Дані для масового завантаження
+    LinkedList<int> loaded(source.begin(), source.end());          // Список з діапазону за один прохід
+    std::ostringstream text;                                       // Вивід не лише в std::cout
+    loaded.print(text);                                            // Друкуємо список у рядковий потік
+    std::cout << "print у рядок: " << text.str();                  // Виводимо отриманий рядок
+    std::stringstream binary;                                      // Двійковий потік (так само працює std::fstream)
+    loaded.serialize(binary);                                      // Записуємо список
+    LinkedList<int> restored = LinkedList<int>::deserialize(binary); // Читаємо його назад
+    std::cout << "Після serialize/deserialize: ";                  // Повідомляємо про вивід
+    restored.print();                                              // Виводимо відновлений список
+    std::istringstream numbersText("1 2 3 4 5");                   // Текстові дані
+    LinkedList<int> parsed(std::istream_iterator<int>(numbersText), std::istream_iterator<int>{}); // Завантаження з потоку
+    std::cout << "З текстового потоку: ";                          // Повідомляємо про вивід
+    parsed.print();                                                // Виводимо список
+    
     // Очищення
     std::cout << "\n=== Очищення списку ===" << std::endl;        // Заголовок для тестування очищення
     intList.clear();                                               // Очищуємо список
@@ -244,4 +2144,4 @@ int main() {                                                        // Голо
     std::cout << "Список порожній: " << (intList.isEmpty() ? "Так" : "Ні") << std::endl; // Перевіряємо чи порожній
     
     return 0;                                                      // Повертаємо 0 (успішне завершення програми)
-}                                                                  // Кінець головної функції
\ No newline at end of file
+}                                                                  // Кінець головної функції
\ No newline at end of file